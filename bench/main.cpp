@@ -0,0 +1,98 @@
+/**
+ * @file main.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * The benchmark harness. Runs every solver configuration (or those selected) over each
+ * corpus given on the command line, printing a table of throughput, latency, search
+ * nodes, and peak memory, and optionally writing the same results as JSON.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "lib/Benchmark.h"
+#include "utils/utils.h"
+
+using namespace std;
+
+//Prints a summary of the command-line interface
+void printUsage(const Benchmark& benchmark) {
+	cout << "Usage: Benchmark [options] <corpus>...\n\n"
+			"Options:\n"
+			"  --repeat N            Solve every puzzle N times per configuration\n"
+			"  --config NAME         Run only the named configuration (may be repeated)\n"
+			"  --json FILE           Also write the results as JSON to the file ('-' for\n"
+			"                        standard output, in place of the table)\n\n"
+			"Configurations:\n";
+	for(int i = 0; i < benchmark.getConfigurations().size(); i++) {
+		cout << "  " << benchmark.getConfigurations()[i].name << "\n";
+	}
+	cout << "\n";
+}
+
+int main(int argc, const char* argv[]) {
+
+	Benchmark benchmark;
+	benchmark.addDefaultConfigurations();
+	vector<string> corpora;
+	vector<string> selected;
+	string json_path;
+
+	for(int i = 1; i < argc; i++) {
+		string arg = argv[i];
+		if(arg == "--help" || arg == "-h") {
+			printUsage(benchmark);
+			return EXIT_SUCCESS;
+		} else if(arg == "--repeat" && i + 1 < argc && Utilities::isDigits(argv[i + 1])) {
+			benchmark.setRepeat(Utilities::stringToInt(argv[++i]));
+		} else if(arg == "--config" && i + 1 < argc) {
+			selected.push_back(argv[++i]);
+		} else if(arg == "--json" && i + 1 < argc) {
+			json_path = argv[++i];
+		} else if(arg.size() > 1 && arg[0] == '-') {
+			cout << "Error: Unrecognized option '" << arg << "'.\n\n";
+			printUsage(benchmark);
+			return EXIT_FAILURE;
+		} else {
+			corpora.push_back(arg);
+		}
+	}
+
+	if(corpora.empty()) {
+		cout << "Error: Missing corpus filename.\n\n";
+		printUsage(benchmark);
+		return EXIT_FAILURE;
+	}
+	if(!selected.empty() && !benchmark.selectConfigurations(selected)) {
+		cout << "Error: Unknown configuration.\n\n";
+		printUsage(benchmark);
+		return EXIT_FAILURE;
+	}
+
+	for(int i = 0; i < corpora.size(); i++) {
+		if(!benchmark.runFile(corpora[i])) {
+			cerr << "Error: Unable to open '" << corpora[i] << "'.\n\n";
+			return EXIT_FAILURE;
+		}
+	}
+
+	if(json_path == "-") {
+		benchmark.writeJson(cout);
+		return EXIT_SUCCESS;
+	}
+	benchmark.writeTable(cout);
+	if(!json_path.empty()) {
+		ofstream json(json_path.c_str());
+		if(!json.is_open()) {
+			cerr << "Error: Unable to write '" << json_path << "'.\n\n";
+			return EXIT_FAILURE;
+		}
+		benchmark.writeJson(json);
+	}
+
+	return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,825 @@
+/**
+ * @file Backtracker.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the GridBacktracker template, a depth-first search over a single working
+ * board for grids of any supported size (4x4, 9x9, 16x16, or 25x25), templated on the
+ * size of a box. The mask width, every loop bound, and the unit and peer tables come
+ * from GridGeometry<BOX> and are fixed at compile time, so each size gets its own fully
+ * specialized engine. Backtracker, the engine Sudoku uses for 9x9 boards, is
+ * GridBacktracker<3>; it alone implements the Solver interface, since a Board holds
+ * only 9x9 grids, while every size shares the search budget (see 'Solver.h').
+ *
+ * Digits are written into the board in place and recorded on a fixed-size trail, and
+ * backtracking undoes trail entries instead of discarding copies of the board. The
+ * memory used by a search is therefore fixed, no matter how deep the search goes, and
+ * the search itself performs no heap allocations.
+ *
+ * The search can optionally run a constraint propagation stage to a fixed point before
+ * every branch. Propagation fills naked singles (cells with one candidate) and hidden
+ * singles (digits with one possible cell in a row, column, or square), and (unless
+ * disabled) removes locked candidates (pointing and claiming). Its changes are recorded
+ * on the same trails as the search's own assignments, so they are undone on backtrack
+ * in the same way.
+ *
+ * The order in which the search visits cells and tries digits is selectable. Cells can
+ * be taken in row-major order or by minimum remaining values (fewest candidates first,
+ * ties broken by the most empty peers), and digits can be tried in ascending order or
+ * least-constraining first (the digit ruling out the fewest peer candidates).
+ *
+ * Besides finding one solution, the search can count or enumerate every solution of a
+ * board; each is handed to a callback straight from the working board as it is found.
+ * A search can be stopped from another thread through a CancellationToken, and bounded
+ * by SearchLimits (see 'Solver.h').
+ */
+
+#ifndef BACKTRACKER_H
+#define BACKTRACKER_H
+
+//Protected includes (for argument and return types)
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+
+//Header includes (for base and member types)
+#include "Solver.h"
+#include "Candidates.h"
+#include "GridGeometry.h"
+#include "CancellationToken.h"
+
+using namespace std;
+
+//9x9 engines implement the Solver interface; engines for other sizes, whose grids a
+//Board cannot hold, take only the search budget and counters
+template<int BOX>
+class GridBacktracker : public conditional<(BOX == 3), Solver, BudgetedSearch>::type {
+
+public:
+
+	typedef GridGeometry<BOX> Geometry;
+	typedef typename Geometry::Mask Mask;
+	typedef typename Geometry::Cell Cell;
+
+	static constexpr int SIDE = Geometry::SIDE;
+	static constexpr int CELLS = Geometry::CELLS;
+
+	//Heuristics for choosing the next cell to branch on
+	enum CellOrder {
+		FIRST_EMPTY,
+		MINIMUM_REMAINING_VALUES
+	};
+
+	//Heuristics for choosing the order in which a cell's digits are tried
+	enum ValueOrder {
+		ASCENDING,
+		LEAST_CONSTRAINING
+	};
+
+private:
+
+	//The working board; unsolved values are denoted by a -1
+	int board[CELLS];
+	GridCandidates<BOX> candidates;
+	//The unsolved cells of the working board, one bit per cell (see 'GridGeometry.h')
+	uint64_t empty_cells[Geometry::WORDS];
+	//Indices of the cells assigned by the search, in the order they were assigned
+	int trail[CELLS];
+	int trail_size;
+
+	//Digits ruled out at each cell by locked candidates (beyond those used by its peers)
+	Mask excluded[CELLS];
+	//Cells whose excluded mask was changed, along with the mask each change replaced.
+	//Masks only ever gain digits along a path, so one entry per cell and digit is always
+	//enough.
+	int elimination_trail[CELLS * SIDE];
+	Mask elimination_previous[CELLS * SIDE];
+	int elimination_size;
+
+	bool propagation;
+	//Whether propagation looks for locked candidates once the singles rules stall
+	bool locked_candidates;
+	CellOrder cell_order;
+	ValueOrder value_order;
+
+	//Enumeration state: the search stops once solution_limit solutions have been found
+	//(zero meaning no limit) or the callback asks it to
+	long solution_limit;
+	long solutions;
+	SolutionCallback* callback;
+	//If not NULL, polled at every node; the search stops once it has been cancelled
+	const CancellationToken* cancellation;
+	//Levels of branching above the node being searched (tracked for the statistics)
+	int depth;
+
+	Mask getCellCandidates(int index) const;
+	void assign(int index, int digit);
+	bool exclude(int index, Mask digits);
+	void undo(int trail_mark, int elimination_mark);
+	bool search(int from);
+	int selectCell(int from) const;
+	int orderValues(int index, int* digits) const;
+	int countEmptyPeers(int index) const;
+	bool recordSolution();
+
+	//Propagation rules; the singles rules return false once they find a contradiction
+	bool propagate();
+	bool fillNakedSingles(bool& changed, Mask* allowed);
+	bool fillHiddenSingles(bool& changed, const Mask* allowed);
+	void eliminateLockedCandidates(bool& changed, Mask* allowed);
+
+public:
+
+	GridBacktracker();
+
+	bool load(const Board& state);
+	bool load(const vector<int>& state);
+	bool load(const uint8_t* state);
+	bool solve();
+	void getBoard(Board& state) const;
+	void getBoard(vector<int>& state) const;
+	void getBoard(uint8_t* state) const;
+	long countSolutions(long limit, SolutionCallback* callback = NULL);
+	int split(int& index, int* digits);
+
+	bool getPropagation() const;
+	void setPropagation(bool enabled);
+	bool getLockedCandidates() const;
+	void setLockedCandidates(bool enabled);
+	CellOrder getCellOrder() const;
+	void setCellOrder(CellOrder order);
+	ValueOrder getValueOrder() const;
+	void setValueOrder(ValueOrder order);
+	void setCancellation(const CancellationToken* token);
+
+};
+
+//The engine for 9x9 boards
+typedef GridBacktracker<3> Backtracker;
+
+/*** Public interface implementation ***/
+
+//Public constructor. Starts out with an empty board, propagation disabled, and cells
+//and digits visited in their natural order.
+template<int BOX>
+GridBacktracker<BOX>::GridBacktracker() {
+	for(int i = 0; i < CELLS; i++) {
+		this->board[i] = -1;
+		this->excluded[i] = 0;
+	}
+	for(int w = 0; w < Geometry::WORDS; w++) {
+		this->empty_cells[w] = 0;
+	}
+	for(int i = 0; i < CELLS; i++) {
+		this->empty_cells[i / 64] |= (uint64_t)1 << (i % 64);
+	}
+	this->trail_size = 0;
+	this->elimination_size = 0;
+	this->propagation = false;
+	this->locked_candidates = true;
+	this->cell_order = FIRST_EMPTY;
+	this->value_order = ASCENDING;
+	this->solution_limit = 1;
+	this->solutions = 0;
+	this->callback = NULL;
+	this->cancellation = NULL;
+	this->depth = 0;
+}
+
+/**
+ * Copies a board into the working board and rebuilds the used-digit masks. Returns
+ * false if the board already contains a conflict, in which case it cannot be solved.
+ *
+ * @param 	state 	A reference to a board
+ */
+template<int BOX>
+bool GridBacktracker<BOX>::load(const Board& state) {
+	static_assert(CELLS == 81, "a Board holds a 9x9 grid");
+	return this->load(state.data());
+}
+
+/**
+ * Copies a game state (unsolved values denoted by -1, missing trailing values treated
+ * as unsolved) into the working board; see below. Returns false if the state holds a
+ * value outside 1 to SIDE or places a digit twice within a unit.
+ *
+ * @param 	state 	A reference to a vector describing a possible game state
+ */
+template<int BOX>
+bool GridBacktracker<BOX>::load(const vector<int>& state) {
+	uint8_t cells[CELLS];
+	bool valid = true;
+	for(int i = 0; i < CELLS; i++) {
+		int value = (i < state.size()) ? state[i] : -1;
+		if(value != -1 && (value < 1 || value > SIDE)) {
+			valid = false;
+			value = -1;
+		}
+		cells[i] = (value == -1) ? 0 : (uint8_t)value;
+	}
+	return this->load(cells) && valid;
+}
+
+/**
+ * Copies a game state held as one byte per cell (zero for an unsolved value, as in a
+ * Board) into the working board and rebuilds the used-digit masks. Returns false if the
+ * state already contains a conflict (or an invalid cell), in which case it cannot be
+ * solved.
+ *
+ * @param 	state 	The first of CELLS bytes describing a possible game state
+ */
+template<int BOX>
+bool GridBacktracker<BOX>::load(const uint8_t* state) {
+	for(int w = 0; w < Geometry::WORDS; w++) {
+		this->empty_cells[w] = 0;
+	}
+	for(int i = 0; i < CELLS; i++) {
+		this->board[i] = (state[i] == 0) ? -1 : state[i];
+		this->excluded[i] = 0;
+		this->empty_cells[i / 64] |= (uint64_t)(state[i] == 0) << (i % 64);
+	}
+	this->trail_size = 0;
+	this->elimination_size = 0;
+	return this->candidates.load(state);
+}
+
+/**
+ * Searches for a solution to the loaded board. Returns a boolean value indicating
+ * whether one was found; if so, the working board holds the solution, otherwise it
+ * is left as it was loaded (unless the search was cancelled part way through).
+ */
+template<int BOX>
+bool GridBacktracker<BOX>::solve() {
+	this->stats.reset();
+	this->solution_limit = 1;
+	this->solutions = 0;
+	this->callback = NULL;
+	this->depth = 0;
+	this->startBudget();
+	this->search(0);
+	return this->solutions > 0;
+}
+
+/**
+ * Counts the solutions of the loaded board without storing any of them, stopping as
+ * soon as 'limit' solutions have been found. If the search stops early, the working
+ * board holds the last solution found; otherwise it is left as it was loaded.
+ *
+ * @param 	limit 		The number of solutions at which to stop (zero for no limit)
+ * @param 	callback 	If not NULL, receives each solution as it is found, and may stop
+ * 						the enumeration by returning false
+ */
+template<int BOX>
+long GridBacktracker<BOX>::countSolutions(long limit, SolutionCallback* callback) {
+	this->stats.reset();
+	this->solution_limit = limit;
+	this->solutions = 0;
+	this->callback = callback;
+	this->depth = 0;
+	this->startBudget();
+	this->search(0);
+	this->callback = NULL;
+	return this->solutions;
+}
+
+/**
+ * Copies the working board into the given board.
+ *
+ * @param 	state 	A reference to the board which will receive the working board
+ */
+template<int BOX>
+void GridBacktracker<BOX>::getBoard(Board& state) const {
+	static_assert(CELLS == 81, "a Board holds a 9x9 grid");
+	for(int i = 0; i < CELLS; i++) {
+		state.set(i, (this->board[i] == -1) ? 0 : (uint8_t)this->board[i]);
+	}
+}
+
+//Copies the working board into the given vector (unsolved values denoted by -1)
+template<int BOX>
+void GridBacktracker<BOX>::getBoard(vector<int>& state) const {
+	state.assign(this->board, this->board + CELLS);
+}
+
+//Copies the working board into an array of CELLS bytes (unsolved values denoted by zero)
+template<int BOX>
+void GridBacktracker<BOX>::getBoard(uint8_t* state) const {
+	for(int i = 0; i < CELLS; i++) {
+		state[i] = (this->board[i] == -1) ? 0 : (uint8_t)this->board[i];
+	}
+}
+
+//Public getter for the propagation member
+template<int BOX>
+bool GridBacktracker<BOX>::getPropagation() const {
+	return this->propagation;
+}
+
+//Public setter for the propagation member; enables or disables the propagation stage
+template<int BOX>
+void GridBacktracker<BOX>::setPropagation(bool enabled) {
+	this->propagation = enabled;
+}
+
+//Public getter for the locked_candidates member
+template<int BOX>
+bool GridBacktracker<BOX>::getLockedCandidates() const {
+	return this->locked_candidates;
+}
+
+/**
+ * Public setter for the locked_candidates member. With it disabled, propagation stops
+ * at the singles rules; the search is wider, but each node is cheaper, which pays off
+ * on boards the singles rules already nearly settle.
+ *
+ * @param 	enabled 	Whether propagation should look for locked candidates
+ */
+template<int BOX>
+void GridBacktracker<BOX>::setLockedCandidates(bool enabled) {
+	this->locked_candidates = enabled;
+}
+
+//Public getter for the cell_order member
+template<int BOX>
+typename GridBacktracker<BOX>::CellOrder GridBacktracker<BOX>::getCellOrder() const {
+	return this->cell_order;
+}
+
+//Public setter for the cell_order member
+template<int BOX>
+void GridBacktracker<BOX>::setCellOrder(CellOrder order) {
+	this->cell_order = order;
+}
+
+//Public getter for the value_order member
+template<int BOX>
+typename GridBacktracker<BOX>::ValueOrder GridBacktracker<BOX>::getValueOrder() const {
+	return this->value_order;
+}
+
+//Public setter for the value_order member
+template<int BOX>
+void GridBacktracker<BOX>::setValueOrder(ValueOrder order) {
+	this->value_order = order;
+}
+
+/**
+ * Sets the token polled by the search; once it is cancelled, solve() and
+ * countSolutions() return as soon as possible with whatever they had found.
+ *
+ * @param 	token 	The token to poll, or NULL to search uncancellably
+ */
+template<int BOX>
+void GridBacktracker<BOX>::setCancellation(const CancellationToken* token) {
+	this->cancellation = token;
+}
+
+/**
+ * Takes the first step of a search without recursing: runs the propagation stage (if
+ * enabled) on the loaded board and chooses the cell the search would branch on first.
+ * The digits to try there are written into an array, in order, and their number is
+ * returned. Lets a search be split into independent subtrees, one per digit.
+ *
+ * @param 	index 	Receives the cell to branch on, or CELLS if the board is already full
+ * @param 	digits 	An array of (at least) SIDE elements to receive the digits
+ */
+template<int BOX>
+int GridBacktracker<BOX>::split(int& index, int* digits) {
+	index = -1;
+	if(this->propagation && !this->propagate()) {
+		return 0;
+	}
+	index = this->selectCell(0);
+	if(index == CELLS || index == -1) {
+		return 0;
+	}
+	return this->orderValues(index, digits);
+}
+
+/*** Private method implementations ***/
+
+//Returns a mask of the digits that could still be placed at the given cell
+template<int BOX>
+inline typename GridBacktracker<BOX>::Mask GridBacktracker<BOX>::getCellCandidates(int index) const {
+	return this->candidates.get(index) & ~this->excluded[index];
+}
+
+//Writes a digit into the working board and records the assignment on the trail
+template<int BOX>
+inline void GridBacktracker<BOX>::assign(int index, int digit) {
+	this->board[index] = digit;
+	this->candidates.place(index, digit);
+	this->empty_cells[index / 64] &= ~((uint64_t)1 << (index % 64));
+	this->trail[this->trail_size++] = index;
+}
+
+/**
+ * Rules out some digits at an empty cell, recording the cell's previous mask on the
+ * elimination trail. Returns true if any digit was actually removed.
+ *
+ * @param 	index 	The index of the cell
+ * @param 	digits 	A mask of the digits to rule out
+ */
+template<int BOX>
+bool GridBacktracker<BOX>::exclude(int index, Mask digits) {
+	Mask removed = this->getCellCandidates(index) & digits;
+	if(removed == 0) {
+		return false;
+	}
+	this->elimination_trail[this->elimination_size] = index;
+	this->elimination_previous[this->elimination_size] = this->excluded[index];
+	this->elimination_size++;
+	this->excluded[index] |= removed;
+	this->stats.locked_candidates += GridCandidates<BOX>::countDigits(removed);
+	return true;
+}
+
+/**
+ * Undoes every assignment and elimination made since the trails held the given number
+ * of entries, restoring assigned cells to -1 and removing their digits from the
+ * used-digit masks.
+ *
+ * @param 	trail_mark 			The size of the assignment trail to return to
+ * @param 	elimination_mark 	The size of the elimination trail to return to
+ */
+template<int BOX>
+void GridBacktracker<BOX>::undo(int trail_mark, int elimination_mark) {
+	while(this->trail_size > trail_mark) {
+		int index = this->trail[--this->trail_size];
+		this->candidates.remove(index, this->board[index]);
+		this->board[index] = -1;
+		this->empty_cells[index / 64] |= (uint64_t)1 << (index % 64);
+	}
+	while(this->elimination_size > elimination_mark) {
+		this->elimination_size--;
+		this->excluded[this->elimination_trail[this->elimination_size]] =
+			this->elimination_previous[this->elimination_size];
+	}
+}
+
+/**
+ * A recursive, in-place approach to solving incomplete Sudoku games. Runs the
+ * propagation stage (if enabled), then chooses a missing value and fills it with each
+ * digit still possible there in turn, recursing on the remainder of the board.
+ *
+ * @param 	from 	The index at which to begin scanning for a missing value; every
+ * 					cell before it has already been filled
+ */
+template<int BOX>
+bool GridBacktracker<BOX>::search(int from) {
+	this->stats.nodes++;
+	SEARCH_STATS_ONLY(this->stats.recordDepth(this->depth));
+	if((this->cancellation != NULL && this->cancellation->isCancelled()) || this->isOverBudget()) {
+		return true;
+	}
+	int trail_mark = this->trail_size;
+	int elimination_mark = this->elimination_size;
+	if(this->propagation && !this->propagate()) {
+		this->undo(trail_mark, elimination_mark);
+		return false;
+	}
+	int index = this->selectCell(from);
+	//Every placement was checked against the masks, so a full board is a valid one
+	if(index == CELLS) {
+		if(this->recordSolution()) {
+			return true;
+		}
+		this->undo(trail_mark, elimination_mark);
+		return false;
+	}
+	if(index != -1) {
+		int branch_trail_mark = this->trail_size;
+		int branch_elimination_mark = this->elimination_size;
+		int digits[SIDE];
+		int count = this->orderValues(index, digits);
+		SEARCH_STATS_ONLY(this->stats.branches++);
+		for(int i = 0; i < count; i++) {
+			SEARCH_STATS_ONLY(this->stats.candidates_tried++);
+			this->assign(index, digits[i]);
+			SEARCH_STATS_ONLY(this->depth++);
+			bool stop = this->search((this->cell_order == FIRST_EMPTY) ? index + 1 : 0);
+			SEARCH_STATS_ONLY(this->depth--);
+			if(stop) {
+				return true;
+			}
+			SEARCH_STATS_ONLY(this->stats.backtracks++);
+			this->undo(branch_trail_mark, branch_elimination_mark);
+		}
+	}
+	//We've hit a dead-end, so put the board back the way we found it
+	this->undo(trail_mark, elimination_mark);
+	return false;
+}
+
+/**
+ * Counts the solution held in the working board and passes it to the callback, if
+ * there is one. Returns true if the search should stop here.
+ */
+template<int BOX>
+bool GridBacktracker<BOX>::recordSolution() {
+	this->solutions++;
+	if(this->callback != NULL && !this->callback->onSolution(this->board)) {
+		return true;
+	}
+	return this->solution_limit > 0 && this->solutions >= this->solution_limit;
+}
+
+/**
+ * Chooses the next cell to branch on according to the cell_order member. Returns CELLS
+ * if the board is full, or -1 if some empty cell has no candidates left (in which case
+ * there is no point branching at all).
+ *
+ * @param 	from 	The index at which to begin scanning for a missing value
+ */
+template<int BOX>
+int GridBacktracker<BOX>::selectCell(int from) const {
+	if(this->cell_order == FIRST_EMPTY) {
+		int index = from;
+		while(index < CELLS && this->board[index] != -1) {
+			index++;
+		}
+		return index;
+	}
+	//Minimum remaining values: fewest candidates first, then most empty peers. A cell's
+	//empty peers are only counted once it ties with another (-1 until then).
+	int best = CELLS;
+	int best_count = SIDE + 1;
+	int best_degree = -1;
+	for(int index = from; index < CELLS; index++) {
+		if(this->board[index] != -1) {
+			continue;
+		}
+		int count = GridCandidates<BOX>::countDigits(this->getCellCandidates(index));
+		if(count > best_count) {
+			continue;
+		}
+		if(count == 0) {
+			return -1;
+		}
+		if(count < best_count) {
+			best = index;
+			best_count = count;
+			best_degree = -1;
+			continue;
+		}
+		if(best_degree == -1) {
+			best_degree = this->countEmptyPeers(best);
+		}
+		int degree = this->countEmptyPeers(index);
+		if(degree > best_degree) {
+			best = index;
+			best_degree = degree;
+		}
+	}
+	return best;
+}
+
+/**
+ * Writes the digits that could be placed at a cell into an array, in the order given
+ * by the value_order member, and returns how many there are.
+ *
+ * @param 	index 	The index of the cell
+ * @param 	digits 	An array of (at least) SIDE elements to receive the digits
+ */
+template<int BOX>
+int GridBacktracker<BOX>::orderValues(int index, int* digits) const {
+	const typename Geometry::Tables& tables = Geometry::TABLES;
+	Mask allowed = this->getCellCandidates(index);
+	int count = 0;
+	while(allowed) {
+		digits[count++] = GridCandidates<BOX>::lowestDigit(allowed);
+		allowed &= allowed - 1;
+	}
+	if(this->value_order == LEAST_CONSTRAINING && count > 1) {
+		//Count the empty peers which would lose each digit as a candidate
+		int constrained[SIDE];
+		for(int i = 0; i < count; i++) {
+			Mask bit = GridCandidates<BOX>::digitToMask(digits[i]);
+			constrained[i] = 0;
+			for(int p = 0; p < Geometry::PEERS; p++) {
+				int peer = tables.peers[index][p];
+				if(this->board[peer] == -1 && (this->getCellCandidates(peer) & bit)) {
+					constrained[i]++;
+				}
+			}
+		}
+		//Insertion sort; stable, so ties keep ascending digit order
+		for(int i = 1; i < count; i++) {
+			int digit = digits[i];
+			int key = constrained[i];
+			int j = i - 1;
+			while(j >= 0 && constrained[j] > key) {
+				digits[j + 1] = digits[j];
+				constrained[j + 1] = constrained[j];
+				j--;
+			}
+			digits[j + 1] = digit;
+			constrained[j + 1] = key;
+		}
+	}
+	return count;
+}
+
+//Returns the number of empty cells sharing a row, column, or square with the given cell
+template<int BOX>
+int GridBacktracker<BOX>::countEmptyPeers(int index) const {
+	const uint64_t* peers = Geometry::TABLES.peer_bits[index];
+	int count = 0;
+	for(int w = 0; w < Geometry::WORDS; w++) {
+		count += __builtin_popcountll(peers[w] & this->empty_cells[w]);
+	}
+	return count;
+}
+
+/**
+ * Applies every propagation rule repeatedly until none of them can make progress.
+ * Locked candidates are only looked for once the cheaper singles rules have stalled.
+ * Returns false if the board was found to be unsolvable.
+ */
+template<int BOX>
+bool GridBacktracker<BOX>::propagate() {
+	PhaseTimer timer;
+	//Candidates of every cell, gathered by each pass of the naked singles rule for the
+	//rules that follow it
+	Mask allowed[CELLS];
+	bool consistent = true;
+	bool changed = true;
+	while(consistent && changed) {
+		changed = false;
+		consistent = this->fillNakedSingles(changed, allowed) && this->fillHiddenSingles(changed, allowed);
+		if(consistent && !changed && this->locked_candidates) {
+			this->eliminateLockedCandidates(changed, allowed);
+		}
+	}
+	SEARCH_STATS_ONLY(this->stats.propagation_seconds += timer.lap());
+	return consistent;
+}
+
+/**
+ * Fills every empty cell that has exactly one candidate, recording the candidates of
+ * every cell as it is reached (none for a filled one). Cells filled later in the pass
+ * only take candidates away, so the record may hold more than are left, never fewer.
+ * Returns false if an empty cell has no candidates at all.
+ *
+ * @param 	changed 	Set to true if any cell was filled
+ * @param 	allowed 	An array of CELLS masks to receive the candidates
+ */
+template<int BOX>
+bool GridBacktracker<BOX>::fillNakedSingles(bool& changed, Mask* allowed) {
+	for(int i = 0; i < CELLS; i++) {
+		allowed[i] = 0;
+		if(this->board[i] != -1) {
+			continue;
+		}
+		Mask digits = this->getCellCandidates(i);
+		if(digits == 0) {
+			return false;
+		}
+		if((digits & (digits - 1)) == 0) {
+			this->assign(i, GridCandidates<BOX>::lowestDigit(digits));
+			this->stats.naked_singles++;
+			changed = true;
+		} else {
+			allowed[i] = digits;
+		}
+	}
+	return true;
+}
+
+/**
+ * For every row, column, and square, fills each digit that can only be placed in one
+ * of the unit's cells. Returns false if some digit can no longer be placed anywhere
+ * within a unit.
+ *
+ * @param 	changed 	Set to true if any cell was filled
+ * @param 	allowed 	The candidates recorded by the naked singles rule. Cells filled
+ * 						since then only take candidates away, so a digit which is a single
+ * 						here is at most a single by the time its unit is reached; its cell
+ * 						is looked up afresh below.
+ */
+template<int BOX>
+bool GridBacktracker<BOX>::fillHiddenSingles(bool& changed, const Mask* allowed) {
+	const typename Geometry::Tables& tables = Geometry::TABLES;
+	for(int unit = 0; unit < Geometry::UNITS; unit++) {
+		const Cell* cells = tables.units[unit];
+		//Digits that are candidates in at least one, and in more than one, empty cell
+		Mask once = 0;
+		Mask twice = 0;
+		Mask placed = this->candidates.getUnitUsed(unit);
+		for(int k = 0; k < SIDE; k++) {
+			twice |= once & allowed[cells[k]];
+			once |= allowed[cells[k]];
+		}
+		if((once | placed) != Geometry::ALL_DIGITS) {
+			return false;
+		}
+		Mask singles = once & ~twice & ~placed;
+		while(singles) {
+			int digit = GridCandidates<BOX>::lowestDigit(singles);
+			singles &= singles - 1;
+			//Earlier singles in this unit may have taken the only cell this digit had
+			int k = 0;
+			while(k < SIDE && (this->board[cells[k]] != -1 ||
+				  !(this->getCellCandidates(cells[k]) & GridCandidates<BOX>::digitToMask(digit)))) {
+				k++;
+			}
+			if(k == SIDE) {
+				return false;
+			}
+			this->assign(cells[k], digit);
+			this->stats.hidden_singles++;
+			changed = true;
+		}
+	}
+	return true;
+}
+
+/**
+ * Removes locked candidates. When a digit's remaining cells within a square all lie in
+ * one row or column (pointing), the digit is ruled out of the rest of that row or
+ * column; when a digit's remaining cells within a row or column all lie in one square
+ * (claiming), it is ruled out of the rest of that square. Any cell left without
+ * candidates is caught by the singles rules on the next pass.
+ *
+ * @param 	changed 	Set to true if any candidate was removed
+ * @param 	allowed 	The candidates of every cell (none for a filled one), exact when
+ * 						the singles rules have just made no progress; kept up to date as
+ * 						digits are ruled out
+ */
+template<int BOX>
+void GridBacktracker<BOX>::eliminateLockedCandidates(bool& changed, Mask* allowed) {
+	typedef GridCandidates<BOX> Digits;
+	const typename Geometry::Tables& tables = Geometry::TABLES;
+	for(int unit = 0; unit < Geometry::UNITS; unit++) {
+		const Cell* cells = tables.units[unit];
+		bool is_square = (unit >= 2 * SIDE);
+		//Candidates of the unit's empty cells, gathered into the segments it shares with
+		//other units: its rows and columns (for a square), or its squares (for a line)
+		Mask row_segments[BOX] = {};
+		Mask col_segments[BOX] = {};
+		for(int k = 0; k < SIDE; k++) {
+			int index = cells[k];
+			if(is_square) {
+				row_segments[Digits::rowOf(index) % BOX] |= allowed[index];
+				col_segments[Digits::colOf(index) % BOX] |= allowed[index];
+			} else {
+				row_segments[((unit < SIDE) ? Digits::colOf(index) : Digits::rowOf(index)) / BOX] |= allowed[index];
+			}
+		}
+		//Digits whose remaining cells all lie in one segment
+		Mask row_locked[BOX];
+		Mask col_locked[BOX];
+		Mask row_any = 0;
+		for(int s = 0; s < BOX; s++) {
+			Mask others = 0;
+			Mask col_others = 0;
+			for(int t = 0; t < BOX; t++) {
+				if(t != s) {
+					others |= row_segments[t];
+					col_others |= col_segments[t];
+				}
+			}
+			row_locked[s] = row_segments[s] & ~others;
+			col_locked[s] = col_segments[s] & ~col_others;
+			row_any |= row_locked[s];
+		}
+		for(int s = 0; s < BOX; s++) {
+			if(is_square) {
+				//Pointing: rule the digits out of the rest of the row or column (a digit
+				//confined to a row is left to the row alone)
+				int square = unit - (2 * SIDE);
+				int lines[2] = { ((square / BOX) * BOX) + s, SIDE + ((square % BOX) * BOX) + s };
+				Mask digits[2] = { row_locked[s], (Mask)(col_locked[s] & ~row_any) };
+				for(int l = 0; l < 2; l++) {
+					if(digits[l] == 0) {
+						continue;
+					}
+					for(int k = 0; k < SIDE; k++) {
+						int index = tables.units[lines[l]][k];
+						if(Digits::squareOf(index) != square && (allowed[index] & digits[l])) {
+							this->exclude(index, digits[l]);
+							allowed[index] &= ~digits[l];
+							changed = true;
+						}
+					}
+				}
+			} else if(row_locked[s] != 0) {
+				//Claiming: rule the digits out of the rest of the square
+				int square = (unit < SIDE) ? ((unit / BOX) * BOX) + s : (s * BOX) + ((unit - SIDE) / BOX);
+				const Cell* square_cells = tables.units[(2 * SIDE) + square];
+				for(int k = 0; k < SIDE; k++) {
+					int index = square_cells[k];
+					bool in_line = (unit < SIDE) ? (Digits::rowOf(index) == unit) :
+												   (Digits::colOf(index) == unit - SIDE);
+					if(!in_line && (allowed[index] & row_locked[s])) {
+						this->exclude(index, row_locked[s]);
+						allowed[index] &= ~row_locked[s];
+						changed = true;
+					}
+				}
+			}
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,540 @@
+/**
+ * @file BatchSolver.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the public interface of the BatchSolver class. For
+ * details about this class, see 'BatchSolver.h'.
+ */
+
+//Protected includes
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <condition_variable>
+#include <stdexcept>
+
+//Header includes
+#include "BatchSolver.h"
+#include "ThreadPool.h"
+#include "BinaryFormat.h"
+
+using namespace std;
+
+//A run of consecutive puzzles, solved together by one worker
+struct BatchChunk {
+	//Views of the chunk's puzzles, which point into 'lines' unless the reader hands out
+	//views of its own bytes
+	vector<PuzzleView> views;
+	vector<string> lines;
+	int count;
+	string output;
+	BatchSummary summary;
+	bool done;
+};
+
+/*** Public interface implementation ***/
+
+/**
+ * Public constructor. The given Sudoku acts as a template: the batch solves every
+ * puzzle with a copy of it, so its strategy and search options apply to the whole batch.
+ *
+ * @param 	configuration 	A Sudoku object configured with the desired search options
+ * @param 	threads 		The number of worker threads (zero for one per hardware thread)
+ */
+BatchSolver::BatchSolver(const Sudoku& configuration, int threads) : sudoku(configuration) {
+	this->setThreads(threads);
+	this->statistics = false;
+	this->binary_output = false;
+	this->side = 9;
+}
+
+//Public getter for the threads member
+int BatchSolver::getThreads() const {
+	return this->threads;
+}
+
+//Public setter for the threads member; zero selects one thread per hardware thread
+void BatchSolver::setThreads(int threads) {
+	this->threads = (threads > 0) ? threads : ThreadPool::getDefaultSize();
+}
+
+//Public getter for the statistics member
+bool BatchSolver::getStatistics() const {
+	return this->statistics;
+}
+
+//Public setter for the statistics member
+void BatchSolver::setStatistics(bool enabled) {
+	this->statistics = enabled;
+}
+
+//Public getter for the binary_output member
+bool BatchSolver::getBinaryOutput() const {
+	return this->binary_output;
+}
+
+//Public setter for the binary_output member
+void BatchSolver::setBinaryOutput(bool enabled) {
+	this->binary_output = enabled;
+}
+
+//Public getter for the side member
+int BatchSolver::getSide() const {
+	return this->side;
+}
+
+/**
+ * Public setter for the side member. Throws an invalid_argument exception for a side
+ * length GridPuzzle doesn't support.
+ *
+ * @param 	side 	The side length of the batch's grids (4, 9, 16, or 25)
+ */
+void BatchSolver::setSide(int side) {
+	if(!GridPuzzle::isSupportedSide(side)) {
+		throw invalid_argument("Batches are supported for grids of side 4, 9, 16, or 25.");
+	}
+	this->side = side;
+}
+
+/**
+ * Reads puzzles from an input stream, one per line, and writes one result line per
+ * puzzle to an output stream (in input order). Returns totals for the batch, including
+ * its wall time.
+ *
+ * @param 	input 	The stream of puzzles
+ * @param 	output 	The stream which will receive one result line per puzzle
+ */
+BatchSummary BatchSolver::run(istream& input, ostream& output) {
+	StreamPuzzleReader reader(input);
+	return this->run(reader, output);
+}
+
+/**
+ * Solves every puzzle yielded by a reader, writing one result line per puzzle to an
+ * output stream (in input order). Returns totals for the batch, including its wall time.
+ *
+ * @param 	input 	The reader yielding puzzles
+ * @param 	output 	The stream which will receive one result line per puzzle
+ */
+BatchSummary BatchSolver::run(PuzzleReader& input, ostream& output) {
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	if(this->binary_output && this->side != 9) {
+		throw invalid_argument("Binary output holds 9x9 solutions only.");
+	}
+	//Binary output starts with a header; the count is filled in afterwards if the stream can seek
+	streampos header_position = this->binary_output ? output.tellp() : streampos(-1);
+	if(this->binary_output) {
+		BinaryWriter::writeHeader(output, BinaryFormat::SOLUTIONS, BinaryFormat::UNKNOWN_COUNT, 0);
+	}
+	BatchSummary summary = (this->threads > 1) ? this->runParallel(input, output) :
+												 this->runSequential(input, output);
+	if(header_position != streampos(-1)) {
+		streampos end = output.tellp();
+		output.seekp(header_position);
+		BinaryWriter::writeHeader(output, BinaryFormat::SOLUTIONS, summary.puzzles, 0);
+		output.seekp(end);
+	}
+	output.flush();
+	summary.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	return summary;
+}
+
+/*** Static class method implementations ***/
+
+/**
+ * Reads the next puzzle line from a stream, skipping blank and comment lines and
+ * dropping any DOS line ending. Returns false once the stream is exhausted.
+ *
+ * @param 	input 	The stream of puzzles
+ * @param 	line 	Receives the line
+ */
+bool BatchSolver::readPuzzleLine(istream& input, string& line) {
+	while(getline(input, line)) {
+		if(!line.empty() && line[line.size() - 1] == '\r') {
+			line.erase(line.size() - 1);
+		}
+		if(!isSkippedLine(line)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Solves the puzzle on one line with the given Sudoku, appending its result line to an
+ * output buffer and counting it in a summary.
+ *
+ * @param 	sudoku 		The Sudoku object used to solve the puzzle
+ * @param 	line 		A line holding one puzzle
+ * @param 	output 		The buffer which receives the result line
+ * @param 	summary 	The totals to which the puzzle is added
+ */
+void BatchSolver::solveLine(Sudoku& sudoku, const string& line, string& output, BatchSummary& summary) {
+	solveLine(sudoku, line.data(), line.size(), output, summary);
+}
+
+/**
+ * Solves the puzzle held by a run of characters (see above). The characters are parsed
+ * where they lie, so a line can be solved straight out of a mapped file.
+ *
+ * @param 	sudoku 		The Sudoku object used to solve the puzzle
+ * @param 	line 		The first character of a line holding one puzzle
+ * @param 	length 		The length of the line, without its line terminator
+ * @param 	output 		The buffer which receives the result line
+ * @param 	summary 	The totals to which the puzzle is added
+ * @param 	statistics 	Whether to follow the result with a tab and the search counters
+ */
+void BatchSolver::solveLine(Sudoku& sudoku, const char* line, size_t length, string& output, BatchSummary& summary,
+							bool statistics) {
+	summary.puzzles++;
+	if(!isPuzzleLine(line, length)) {
+		summary.invalid++;
+		output += "invalid\n";
+		return;
+	}
+	sudoku.setState(line, length);
+	appendResult(sudoku, output, summary, statistics);
+}
+
+/**
+ * Solves a puzzle that has already been decoded into a board (see above), so a binary
+ * corpus is solved without a detour through the text format.
+ *
+ * @param 	sudoku 		The Sudoku object used to solve the puzzle
+ * @param 	puzzle 		The puzzle
+ * @param 	output 		The buffer which receives the result line
+ * @param 	summary 	The totals to which the puzzle is added
+ * @param 	statistics 	Whether to follow the result with a tab and the search counters
+ */
+void BatchSolver::solveBoard(Sudoku& sudoku, const Board& puzzle, string& output, BatchSummary& summary,
+							 bool statistics) {
+	summary.puzzles++;
+	if(!isPuzzleBoard(puzzle)) {
+		summary.invalid++;
+		output += "invalid\n";
+		return;
+	}
+	sudoku.setState(puzzle);
+	appendResult(sudoku, output, summary, statistics);
+}
+
+/**
+ * Solves the puzzle held by a run of characters (see above), appending its result to an
+ * output buffer as a binary solution record (see 'BinaryFormat.h') and counting it in
+ * a summary.
+ *
+ * @param 	sudoku 		The Sudoku object used to solve the puzzle
+ * @param 	line 		The first character of a line holding one puzzle
+ * @param 	length 		The length of the line, without its line terminator
+ * @param 	output 		The buffer which receives the record
+ * @param 	summary 	The totals to which the puzzle is added
+ */
+void BatchSolver::solveRecord(Sudoku& sudoku, const char* line, size_t length, string& output, BatchSummary& summary) {
+	bool valid = isPuzzleLine(line, length);
+	if(valid) {
+		sudoku.setState(line, length);
+	}
+	appendRecord(sudoku, valid, output, summary);
+}
+
+/**
+ * Solves a puzzle that has already been decoded into a board, appending its result as
+ * a binary solution record (see above).
+ *
+ * @param 	sudoku 		The Sudoku object used to solve the puzzle
+ * @param 	puzzle 		The puzzle
+ * @param 	output 		The buffer which receives the record
+ * @param 	summary 	The totals to which the puzzle is added
+ */
+void BatchSolver::solveRecord(Sudoku& sudoku, const Board& puzzle, string& output, BatchSummary& summary) {
+	bool valid = isPuzzleBoard(puzzle);
+	if(valid) {
+		sudoku.setState(puzzle);
+	}
+	appendRecord(sudoku, valid, output, summary);
+}
+
+/**
+ * Solves the puzzle on one line as a grid of the given GridPuzzle's size, in either
+ * grid format (see 'GridPuzzle.h'), appending its result line to an output buffer and
+ * counting it in a summary. Solutions are written in the token format.
+ *
+ * @param 	grid 		The GridPuzzle object used to solve the puzzle
+ * @param 	line 		The first character of a line holding one puzzle
+ * @param 	length 		The length of the line, without its line terminator
+ * @param 	output 		The buffer which receives the result line
+ * @param 	summary 	The totals to which the puzzle is added
+ * @param 	statistics 	Whether to follow the result with a tab and the search counters
+ */
+void BatchSolver::solveGridLine(GridPuzzle& grid, const char* line, size_t length, string& output,
+								BatchSummary& summary, bool statistics) {
+	summary.puzzles++;
+	if(!grid.setState(string(line, length))) {
+		summary.invalid++;
+		output += "invalid\n";
+		return;
+	}
+	if(grid.solve()) {
+		summary.solved++;
+		string solution;
+		GridPuzzle::formatLine(grid.getCurrentBoard(), solution);
+		output += solution;
+	} else {
+		summary.unsolvable++;
+		output += "unsolvable";
+	}
+	summary.stats.add(grid.getStats());
+	if(statistics) {
+		output += '\t';
+		formatStats(grid.getStats(), output);
+	}
+	output += '\n';
+}
+
+/**
+ * Returns a boolean value indicating whether a line holds a puzzle in the one-line
+ * format: exactly 81 characters, each a digit or a '.'.
+ *
+ * @param 	line 	A line of input, without its line terminator
+ */
+bool BatchSolver::isPuzzleLine(const string& line) {
+	return isPuzzleLine(line.data(), line.size());
+}
+
+bool BatchSolver::isPuzzleLine(const char* line, size_t length) {
+	if(length != 81) {
+		return false;
+	}
+	for(int i = 0; i < 81; i++) {
+		char c = line[i];
+		if(c != '.' && (c < '0' || c > '9')) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//Returns whether a decoded board holds a puzzle: every cell a digit or missing
+bool BatchSolver::isPuzzleBoard(const Board& puzzle) {
+	for(int i = 0; i < 81; i++) {
+		if(puzzle.get(i) > 9) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//Returns whether a line is blank (only whitespace) or a '#' comment
+bool BatchSolver::isSkippedLine(const string& line) {
+	return isSkippedLine(line.data(), line.size());
+}
+
+bool BatchSolver::isSkippedLine(const char* line, size_t length) {
+	size_t first = 0;
+	while(first < length && (line[first] == ' ' || line[first] == '\t')) {
+		first++;
+	}
+	return first == length || line[first] == '#';
+}
+
+/**
+ * Writes a board into a string in the one-line format, using '.' for missing values.
+ *
+ * @param 	board 	A reference to a vector describing a game state
+ * @param 	line 	A reference to the string which will receive the board
+ */
+void BatchSolver::formatBoard(const vector<int>& board, string& line) {
+	line.resize(board.size());
+	for(int i = 0; i < board.size(); i++) {
+		line[i] = (board[i] == -1) ? '.' : (char)('0' + board[i]);
+	}
+}
+
+/**
+ * Appends a search's counters to a line as space-separated 'name=value' pairs, with
+ * phase times in microseconds.
+ *
+ * @param 	stats 	The counters of a search
+ * @param 	line 	The line to which the counters are appended
+ */
+void BatchSolver::formatStats(const SearchStats& stats, string& line) {
+	char buffer[320];
+	snprintf(buffer, sizeof(buffer),
+			 "nodes=%ld branches=%ld tried=%ld backtracks=%ld max_depth=%d naked_singles=%ld "
+			 "hidden_singles=%ld locked_candidates=%ld load_us=%.1f propagation_us=%.1f search_us=%.1f",
+			 stats.nodes, stats.branches, stats.candidates_tried, stats.backtracks, stats.max_depth,
+			 stats.naked_singles, stats.hidden_singles, stats.locked_candidates,
+			 stats.load_seconds * 1e6, stats.propagation_seconds * 1e6, stats.search_seconds * 1e6);
+	line += buffer;
+}
+
+/*** Private method implementations ***/
+
+/**
+ * Solves the puzzle loaded into a Sudoku object, appending its result line to an
+ * output buffer and counting it in a summary (see solveLine()).
+ *
+ * @param 	sudoku 		The Sudoku object holding the puzzle
+ * @param 	output 		The buffer which receives the result line
+ * @param 	summary 	The totals to which the puzzle is added
+ * @param 	statistics 	Whether to follow the result with a tab and the search counters
+ */
+void BatchSolver::appendResult(Sudoku& sudoku, string& output, BatchSummary& summary, bool statistics) {
+	if(sudoku.solve()) {
+		summary.solved++;
+		const Board& board = sudoku.getCurrentCells();
+		for(int i = 0; i < 81; i++) {
+			output += (char)('0' + board.get(i));
+		}
+	} else {
+		summary.unsolvable++;
+		output += "unsolvable";
+	}
+	summary.stats.add(sudoku.getStats());
+	if(statistics) {
+		output += '\t';
+		formatStats(sudoku.getStats(), output);
+	}
+	output += '\n';
+}
+
+/**
+ * Solves the puzzle loaded into a Sudoku object, if it is a valid one, appending its
+ * result as a binary solution record and counting it in a summary (see solveRecord()).
+ *
+ * @param 	sudoku 		The Sudoku object holding the puzzle
+ * @param 	valid 		Whether a well-formed puzzle was loaded; an invalid record is
+ * 						written otherwise
+ * @param 	output 		The buffer which receives the record
+ * @param 	summary 	The totals to which the puzzle is added
+ */
+void BatchSolver::appendRecord(Sudoku& sudoku, bool valid, string& output, BatchSummary& summary) {
+	uint8_t record[BinaryFormat::SOLUTION_RECORD_SIZE];
+	BinaryFormat::Status status = BinaryFormat::INVALID;
+	summary.puzzles++;
+	if(!valid) {
+		summary.invalid++;
+	} else {
+		if(sudoku.solve()) {
+			summary.solved++;
+			status = BinaryFormat::SOLVED;
+		} else {
+			summary.unsolvable++;
+			status = BinaryFormat::UNSOLVABLE;
+		}
+		summary.stats.add(sudoku.getStats());
+	}
+	BinaryFormat::encodeSolution(sudoku.getCurrentCells(), status, record);
+	output.append((const char*)record, sizeof(record));
+}
+
+//Solves one puzzle of the batch with whichever solver its grid size calls for, in the
+//batch's output format
+void BatchSolver::solveView(Sudoku& sudoku, GridPuzzle& grid, const PuzzleView& view, string& output,
+							BatchSummary& summary) const {
+	if(this->side != 9) {
+		solveGridLine(grid, view.data, view.size, output, summary, this->statistics);
+	} else if(view.decoded) {
+		if(this->binary_output) {
+			solveRecord(sudoku, view.board, output, summary);
+		} else {
+			solveBoard(sudoku, view.board, output, summary, this->statistics);
+		}
+	} else if(this->binary_output) {
+		solveRecord(sudoku, view.data, view.size, output, summary);
+	} else {
+		solveLine(sudoku, view.data, view.size, output, summary, this->statistics);
+	}
+}
+
+//Solves the batch on the calling thread, writing results out a chunk at a time
+BatchSummary BatchSolver::runSequential(PuzzleReader& input, ostream& output) {
+	BatchSummary summary;
+	//Both buffers are reused for every puzzle, so steady-state solving doesn't allocate
+	PuzzleView view;
+	string line;
+	string results;
+	GridPuzzle grid(GridPuzzle::getBoxSizeOfSide(this->side));
+	int buffered = 0;
+	while(input.next(view, line)) {
+		this->solveView(this->sudoku, grid, view, results, summary);
+		if(++buffered == CHUNK_SIZE) {
+			output.write(results.data(), results.size());
+			results.clear();
+			buffered = 0;
+		}
+	}
+	output.write(results.data(), results.size());
+	return summary;
+}
+
+/**
+ * Solves the batch on a thread pool. The calling thread reads chunks of puzzles and
+ * queues them, then writes out finished chunks in input order. At most a few chunks
+ * per worker are in flight at once; their buffers are recycled from chunk to chunk.
+ */
+BatchSummary BatchSolver::runParallel(PuzzleReader& input, ostream& output) {
+	BatchSummary summary;
+	ThreadPool pool(this->threads);
+	//Per-worker solver state; no Sudoku object is ever shared between threads
+	vector<Sudoku> solvers(pool.size(), this->sudoku);
+	vector<GridPuzzle> grids(pool.size(), GridPuzzle(GridPuzzle::getBoxSizeOfSide(this->side)));
+	//Ring of chunk buffers forming the reorder buffer
+	const int ring_size = pool.size() * 4;
+	vector<BatchChunk> ring(ring_size);
+	mutex done_lock;
+	condition_variable chunk_done;
+	long next_read = 0;
+	long next_write = 0;
+	bool exhausted = false;
+	while(!exhausted || next_write < next_read) {
+		//Fill every free slot of the ring with a chunk of puzzles
+		while(!exhausted && next_read - next_write < ring_size) {
+			BatchChunk& chunk = ring[next_read % ring_size];
+			chunk.views.resize(CHUNK_SIZE);
+			chunk.lines.resize(CHUNK_SIZE);
+			chunk.count = 0;
+			while(chunk.count < CHUNK_SIZE && input.next(chunk.views[chunk.count], chunk.lines[chunk.count])) {
+				chunk.count++;
+			}
+			if(chunk.count < CHUNK_SIZE) {
+				exhausted = true;
+			}
+			if(chunk.count == 0) {
+				break;
+			}
+			chunk.output.clear();
+			chunk.summary = BatchSummary();
+			chunk.done = false;
+			BatchChunk* target = &chunk;
+			pool.submit([this, target, &solvers, &grids, &done_lock, &chunk_done](int worker) {
+				for(int i = 0; i < target->count; i++) {
+					this->solveView(solvers[worker], grids[worker], target->views[i], target->output, target->summary);
+				}
+				lock_guard<mutex> guard(done_lock);
+				target->done = true;
+				chunk_done.notify_all();
+			});
+			next_read++;
+		}
+		if(next_write == next_read) {
+			continue;
+		}
+		//Write out the oldest chunk once it has been solved
+		BatchChunk& chunk = ring[next_write % ring_size];
+		{
+			unique_lock<mutex> guard(done_lock);
+			while(!chunk.done) {
+				chunk_done.wait(guard);
+			}
+		}
+		output.write(chunk.output.data(), chunk.output.size());
+		summary.add(chunk.summary);
+		next_write++;
+	}
+	return summary;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file BatchSolver.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the BatchSolver class, which solves a whole corpus of puzzles in a single
+ * process. Input uses the common one-puzzle-per-line format: 81 characters per line,
+ * read left-to-right, top-to-bottom, with '.' or '0' marking a missing value. For each
+ * puzzle, one line is written: the 81-digit solution, "unsolvable", or "invalid" (for
+ * a line that is not a well-formed puzzle). Blank lines and lines beginning with '#'
+ * are skipped.
+ *
+ * With more than one thread, puzzles are read in chunks which are solved on a
+ * work-stealing ThreadPool, each worker with its own Sudoku object. Finished chunks
+ * wait in a reorder buffer until every chunk before them has been written, so results
+ * always come out in input order. The number of chunks in flight is bounded, so
+ * memory use doesn't grow with the size of the corpus.
+ *
+ * Puzzles come from a PuzzleReader. Given a MappedPuzzleReader, every puzzle is solved
+ * straight from the mapped file, without being copied; given a BinaryPuzzleReader, from
+ * the boards it decodes out of a binary corpus (see 'BinaryFormat.h'), which never pass
+ * through the text format. With binary output, results are written as a binary file of
+ * solution records instead of text lines, one record per puzzle.
+ *
+ * A batch of grids of another size (4x4, 16x16, or 25x25) is solved the same way, one
+ * puzzle per line in either GridPuzzle format, with each worker holding a GridPuzzle
+ * instead of a Sudoku; solutions are written in the token format. Such a batch is read
+ * and written as text only.
+ */
+
+#ifndef BATCH_SOLVER_H
+#define BATCH_SOLVER_H
+
+//Protected includes (for argument and return types)
+#include <iostream>
+#include <string>
+#include <vector>
+
+//Header includes (for member and argument types)
+#include "Sudoku.h"
+#include "PuzzleReader.h"
+#include "GridPuzzle.h"
+
+using namespace std;
+
+//Totals describing a single call to BatchSolver::run
+struct BatchSummary {
+
+	long puzzles;
+	long solved;
+	long unsolvable;
+	long invalid;
+	//Wall-clock time spent reading, solving, and writing, in seconds
+	double seconds;
+	//Search counters summed over every puzzle
+	SearchStats stats;
+
+	BatchSummary() {
+		this->puzzles = 0;
+		this->solved = 0;
+		this->unsolvable = 0;
+		this->invalid = 0;
+		this->seconds = 0;
+	}
+
+	void add(const BatchSummary& other) {
+		this->puzzles += other.puzzles;
+		this->solved += other.solved;
+		this->unsolvable += other.unsolvable;
+		this->invalid += other.invalid;
+		this->stats.add(other.stats);
+	}
+
+	double getPuzzlesPerSecond() const {
+		return (this->seconds > 0) ? (this->puzzles / this->seconds) : 0;
+	}
+
+};
+
+class BatchSolver {
+
+private:
+
+	//Solves every puzzle of the batch (or, with several threads, serves as the template
+	//for each worker's own Sudoku); its strategy and search options apply to the batch
+	Sudoku sudoku;
+	int threads;
+	//Whether each result line is followed by the puzzle's search counters
+	bool statistics;
+	//Whether results are written as binary solution records (statistics are then left out)
+	bool binary_output;
+	//Side length of the batch's grids; anything but 9 is solved through GridPuzzle
+	int side;
+
+	void solveView(Sudoku& sudoku, GridPuzzle& grid, const PuzzleView& view, string& output,
+				   BatchSummary& summary) const;
+	static void appendResult(Sudoku& sudoku, string& output, BatchSummary& summary, bool statistics);
+	static void appendRecord(Sudoku& sudoku, bool valid, string& output, BatchSummary& summary);
+
+	BatchSummary runSequential(PuzzleReader& input, ostream& output);
+	BatchSummary runParallel(PuzzleReader& input, ostream& output);
+
+public:
+
+	//Number of puzzles handed to a worker at a time
+	static const int CHUNK_SIZE = 256;
+
+	BatchSolver(const Sudoku& configuration, int threads = 1);
+
+	int getThreads() const;
+	void setThreads(int threads);
+	bool getStatistics() const;
+	void setStatistics(bool enabled);
+	bool getBinaryOutput() const;
+	void setBinaryOutput(bool enabled);
+	int getSide() const;
+	void setSide(int side);
+
+	BatchSummary run(istream& input, ostream& output);
+	BatchSummary run(PuzzleReader& input, ostream& output);
+
+	//Static helper functions for the one-line puzzle format
+	static bool readPuzzleLine(istream& input, string& line);
+	static void solveLine(Sudoku& sudoku, const string& line, string& output, BatchSummary& summary);
+	static void solveLine(Sudoku& sudoku, const char* line, size_t length, string& output, BatchSummary& summary,
+						  bool statistics = false);
+	static void solveRecord(Sudoku& sudoku, const char* line, size_t length, string& output, BatchSummary& summary);
+	static void solveBoard(Sudoku& sudoku, const Board& puzzle, string& output, BatchSummary& summary,
+						   bool statistics = false);
+	static void solveRecord(Sudoku& sudoku, const Board& puzzle, string& output, BatchSummary& summary);
+	static void solveGridLine(GridPuzzle& grid, const char* line, size_t length, string& output,
+							  BatchSummary& summary, bool statistics = false);
+	static bool isPuzzleLine(const string& line);
+	static bool isPuzzleLine(const char* line, size_t length);
+	static bool isPuzzleBoard(const Board& puzzle);
+	static bool isSkippedLine(const string& line);
+	static bool isSkippedLine(const char* line, size_t length);
+	static void formatBoard(const vector<int>& board, string& line);
+	static void formatStats(const SearchStats& stats, string& line);
+
+};
+
+#endif
@@ -0,0 +1,403 @@
+/**
+ * @file Benchmark.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the public interface of the Benchmark class. For
+ * details about this class, see 'Benchmark.h'.
+ */
+
+//Protected includes
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+//Header includes
+#include "Benchmark.h"
+#include "BatchSolver.h"
+#include "GridPuzzle.h"
+
+using namespace std;
+
+/*** Public interface implementation ***/
+
+//Public constructor. Starts out with no configurations, solving each puzzle once.
+Benchmark::Benchmark() {
+	this->repeat = 1;
+}
+
+//Public getter for the repeat member
+int Benchmark::getRepeat() const {
+	return this->repeat;
+}
+
+//Public setter for the repeat member; every puzzle is solved at least once
+void Benchmark::setRepeat(int repeat) {
+	this->repeat = (repeat > 0) ? repeat : 1;
+}
+
+//Public getter for the configurations member
+const vector<BenchmarkConfiguration>& Benchmark::getConfigurations() const {
+	return this->configurations;
+}
+
+//Returns the result of every corpus run so far, in the order they were run
+const vector<BenchmarkResult>& Benchmark::getResults() const {
+	return this->results;
+}
+
+/**
+ * Adds a configuration which solves puzzles with a copy of the given Sudoku object, so
+ * its strategy, search options, and thread count apply.
+ *
+ * @param 	name 			The name under which the configuration is reported
+ * @param 	configuration 	A Sudoku object configured with the desired search options
+ */
+void Benchmark::addConfiguration(const string& name, const Sudoku& configuration) {
+	this->configurations.push_back(BenchmarkConfiguration(name, configuration));
+}
+
+/**
+ * Adds a configuration which solves puzzles through GridPuzzle, as grids of other sizes
+ * are solved.
+ *
+ * @param 	name 	The name under which the configuration is reported
+ */
+void Benchmark::addGridConfiguration(const string& name) {
+	this->configurations.push_back(BenchmarkConfiguration(name, Sudoku(""), true));
+}
+
+//Adds one configuration for each engine, and for each backtracking heuristic, all with
+//triage off so that they time the search alone; then dancing links again with triage
+//on, to show what the triage stage costs or saves
+void Benchmark::addDefaultConfigurations() {
+	Sudoku sudoku("");
+	sudoku.setTriage(false);
+	this->addConfiguration("backtracking", sudoku);
+	sudoku.setCellOrder(Backtracker::MINIMUM_REMAINING_VALUES);
+	this->addConfiguration("mrv", sudoku);
+	sudoku.setPropagation(true);
+	this->addConfiguration("propagate+mrv", sudoku);
+	sudoku.setValueOrder(Backtracker::LEAST_CONSTRAINING);
+	this->addConfiguration("propagate+mrv+lcv", sudoku);
+	Sudoku dlx("", Sudoku::DANCING_LINKS);
+	dlx.setTriage(false);
+	this->addConfiguration("dlx", dlx);
+	Sudoku templates("", Sudoku::TEMPLATES);
+	templates.setTriage(false);
+	this->addConfiguration("templates", templates);
+	this->addGridConfiguration("grid");
+	dlx.setTriage(true);
+	this->addConfiguration("dlx+triage", dlx);
+}
+
+/**
+ * Keeps only the named configurations, in the order named. Returns false (leaving the
+ * configurations alone) if any name does not match a configuration.
+ *
+ * @param 	names 	The names of the configurations to keep
+ */
+bool Benchmark::selectConfigurations(const vector<string>& names) {
+	vector<BenchmarkConfiguration> selected;
+	for(int i = 0; i < names.size(); i++) {
+		int k = 0;
+		while(k < this->configurations.size() && this->configurations[k].name != names[i]) {
+			k++;
+		}
+		if(k == this->configurations.size()) {
+			return false;
+		}
+		selected.push_back(this->configurations[k]);
+	}
+	this->configurations = selected;
+	return true;
+}
+
+/**
+ * Runs every configuration over a corpus of puzzle lines, recording and returning one
+ * result per configuration (the last of which is returned).
+ *
+ * @param 	corpus 		The name under which the corpus is reported
+ * @param 	puzzles 	The corpus, one puzzle per string
+ */
+BenchmarkResult Benchmark::runCorpus(const string& corpus, const vector<string>& puzzles) {
+	BenchmarkResult result;
+	for(int i = 0; i < this->configurations.size(); i++) {
+		result = this->runIsolated(this->configurations[i], puzzles);
+		result.corpus = corpus;
+		this->results.push_back(result);
+	}
+	return result;
+}
+
+/**
+ * Reads a corpus file and runs every configuration over it, naming the corpus after
+ * the file. Returns false if the file could not be read.
+ *
+ * @param 	path 	The path of the corpus
+ */
+bool Benchmark::runFile(const string& path) {
+	vector<string> puzzles;
+	if(!readCorpus(path, puzzles)) {
+		return false;
+	}
+	this->runCorpus(getCorpusName(path), puzzles);
+	return true;
+}
+
+//Writes the results as a table, one row per corpus and configuration
+void Benchmark::writeTable(ostream& output) const {
+	output << left << setw(16) << "corpus" << setw(20) << "configuration" << right
+		   << setw(8) << "puzzles" << setw(8) << "solved" << setw(13) << "puzzles/sec"
+		   << setw(11) << "mean (us)" << setw(11) << "p50 (us)" << setw(11) << "p99 (us)"
+		   << setw(12) << "max (us)" << setw(14) << "nodes/puzzle" << setw(14) << "peak RSS (KB)" << "\n";
+	output << fixed;
+	for(int i = 0; i < this->results.size(); i++) {
+		const BenchmarkResult& result = this->results[i];
+		output << left << setw(16) << result.corpus << setw(20) << result.configuration << right
+			   << setw(8) << result.puzzles << setw(8) << result.solved
+			   << setprecision(0) << setw(13) << result.getPuzzlesPerSecond()
+			   << setprecision(1) << setw(11) << result.mean_latency << setw(11) << result.p50_latency
+			   << setw(11) << result.p99_latency << setw(12) << result.max_latency
+			   << setw(14) << result.nodes_per_puzzle << setw(14) << result.peak_rss << "\n";
+	}
+	output.unsetf(ios::floatfield);
+	output << setprecision(6);
+}
+
+//Writes the results as a JSON document: an object holding an array of results
+void Benchmark::writeJson(ostream& output) const {
+	output << "{\n  \"repeat\": " << this->repeat << ",\n  \"results\": [";
+	for(int i = 0; i < this->results.size(); i++) {
+		const BenchmarkResult& result = this->results[i];
+		//Corpus and configuration names come from file names and the fixed set above, so
+		//only quotes and backslashes need escaping
+		string names[2] = {result.corpus, result.configuration};
+		for(int k = 0; k < 2; k++) {
+			string escaped;
+			for(int c = 0; c < names[k].size(); c++) {
+				if(names[k][c] == '"' || names[k][c] == '\\') {
+					escaped += '\\';
+				}
+				escaped += names[k][c];
+			}
+			names[k] = escaped;
+		}
+		output << ((i > 0) ? ",\n" : "\n")
+			   << "    {\"corpus\": \"" << names[0] << "\", \"configuration\": \"" << names[1] << "\", "
+			   << "\"puzzles\": " << result.puzzles << ", \"solved\": " << result.solved << ", "
+			   << "\"unsolvable\": " << result.unsolvable << ", \"invalid\": " << result.invalid << ", "
+			   << "\"runs\": " << result.runs << ", \"seconds\": " << result.seconds << ", "
+			   << "\"puzzles_per_second\": " << result.getPuzzlesPerSecond() << ", "
+			   << "\"latency_us\": {\"mean\": " << result.mean_latency << ", \"p50\": " << result.p50_latency
+			   << ", \"p99\": " << result.p99_latency << ", \"max\": " << result.max_latency << "}, "
+			   << "\"nodes_per_puzzle\": " << result.nodes_per_puzzle << ", "
+			   << "\"peak_rss_kb\": " << result.peak_rss << "}";
+	}
+	output << "\n  ]\n}\n";
+}
+
+/*** Static class method implementations ***/
+
+/**
+ * Returns the nearest-rank percentile of a sorted list of samples (zero for an empty
+ * list).
+ *
+ * @param 	sorted 		The samples, in ascending order
+ * @param 	fraction 	The percentile as a fraction, from 0 to 1
+ */
+double Benchmark::getPercentile(const vector<double>& sorted, double fraction) {
+	if(sorted.empty()) {
+		return 0;
+	}
+	long rank = (long)ceil(fraction * sorted.size());
+	rank = (rank < 1) ? 1 : (rank > sorted.size()) ? sorted.size() : rank;
+	return sorted[rank - 1];
+}
+
+//Returns the most memory the process has held resident at once, in kilobytes
+long Benchmark::getPeakResidentKilobytes() {
+	struct rusage usage;
+	if(getrusage(RUSAGE_SELF, &usage) != 0) {
+		return 0;
+	}
+	return usage.ru_maxrss;
+}
+
+/**
+ * Names a corpus after its file: the file name without its directory or extension.
+ *
+ * @param 	path 	The path of the corpus
+ */
+string Benchmark::getCorpusName(const string& path) {
+	size_t slash = path.find_last_of('/');
+	string name = (slash == string::npos) ? path : path.substr(slash + 1);
+	size_t dot = name.find_last_of('.');
+	return (dot == string::npos || dot == 0) ? name : name.substr(0, dot);
+}
+
+/**
+ * Reads every puzzle line of a corpus file into memory (skipping blank and comment
+ * lines). Returns false if the file could not be opened.
+ *
+ * @param 	path 		The path of the corpus
+ * @param 	puzzles 	Receives the puzzle lines
+ */
+bool Benchmark::readCorpus(const string& path, vector<string>& puzzles) {
+	ifstream input(path.c_str());
+	if(!input.is_open()) {
+		return false;
+	}
+	puzzles.clear();
+	string line;
+	while(BatchSolver::readPuzzleLine(input, line)) {
+		puzzles.push_back(line);
+	}
+	return true;
+}
+
+/*** Private method implementations ***/
+
+/**
+ * Solves every puzzle of a corpus with one configuration, 'repeat' times over, timing
+ * each solve (parsing included). Outcomes are counted over the first pass; latencies
+ * and nodes are taken from every pass.
+ *
+ * @param 	configuration 	The configuration to run
+ * @param 	puzzles 		The corpus, one puzzle per string
+ */
+BenchmarkResult Benchmark::runConfiguration(BenchmarkConfiguration& configuration, const vector<string>& puzzles) {
+	BenchmarkResult result;
+	result.configuration = configuration.name;
+	vector<double> latencies;
+	latencies.reserve(puzzles.size() * this->repeat);
+	double nodes = 0;
+	GridPuzzle grid(3);
+	for(int pass = 0; pass < this->repeat; pass++) {
+		for(int i = 0; i < puzzles.size(); i++) {
+			const string& puzzle = puzzles[i];
+			if(!BatchSolver::isPuzzleLine(puzzle)) {
+				result.invalid += (pass == 0) ? 1 : 0;
+				continue;
+			}
+			bool solved;
+			chrono::steady_clock::time_point start = chrono::steady_clock::now();
+			if(configuration.grid) {
+				solved = grid.setState(puzzle) && grid.solve();
+			} else {
+				configuration.sudoku.setState(puzzle.data(), puzzle.size());
+				solved = configuration.sudoku.solve();
+			}
+			double latency = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+			latencies.push_back(latency);
+			nodes += configuration.grid ? grid.getStats().nodes : configuration.sudoku.getStats().nodes;
+			if(pass == 0) {
+				result.solved += solved ? 1 : 0;
+				result.unsolvable += solved ? 0 : 1;
+			}
+		}
+	}
+	result.puzzles = result.solved + result.unsolvable + result.invalid;
+	result.runs = latencies.size();
+	for(int i = 0; i < latencies.size(); i++) {
+		result.seconds += latencies[i] / 1000000.0;
+	}
+	if(result.runs > 0) {
+		sort(latencies.begin(), latencies.end());
+		result.mean_latency = (result.seconds * 1000000.0) / result.runs;
+		result.p50_latency = getPercentile(latencies, 0.50);
+		result.p99_latency = getPercentile(latencies, 0.99);
+		result.max_latency = latencies.back();
+		result.nodes_per_puzzle = nodes / result.runs;
+	}
+	return result;
+}
+
+/**
+ * Runs one configuration over a corpus (see above) in a child process, which measures
+ * its own peak resident set size and passes its measurements back through a pipe. If
+ * no child can be started, the configuration is run in this process instead, and the
+ * process's own high-water mark is reported.
+ *
+ * @param 	configuration 	The configuration to run
+ * @param 	puzzles 		The corpus, one puzzle per string
+ */
+BenchmarkResult Benchmark::runIsolated(BenchmarkConfiguration& configuration, const vector<string>& puzzles) {
+	int channel[2];
+	pid_t child = -1;
+	//Anything still buffered would otherwise be written by both processes
+	cout.flush();
+	cerr.flush();
+	if(pipe(channel) == 0) {
+		child = fork();
+		if(child == -1) {
+			close(channel[0]);
+			close(channel[1]);
+		}
+	}
+	if(child == -1) {
+		BenchmarkResult result = this->runConfiguration(configuration, puzzles);
+		result.peak_rss = getPeakResidentKilobytes();
+		return result;
+	}
+	long counts[6];
+	double measurements[6];
+	if(child == 0) {
+		close(channel[0]);
+		BenchmarkResult result = this->runConfiguration(configuration, puzzles);
+		long child_counts[6] = { result.puzzles, result.solved, result.unsolvable, result.invalid, result.runs,
+								 getPeakResidentKilobytes() };
+		double child_measurements[6] = { result.seconds, result.mean_latency, result.p50_latency,
+										 result.p99_latency, result.max_latency, result.nodes_per_puzzle };
+		bool sent = write(channel[1], child_counts, sizeof(child_counts)) == sizeof(child_counts) &&
+					write(channel[1], child_measurements, sizeof(child_measurements)) == sizeof(child_measurements);
+		_exit(sent ? 0 : 1);
+	}
+	close(channel[1]);
+	//The pipe holds far less than a pipe buffer, so the child never blocks on it, but a
+	//read may still return part of the data
+	char* targets[2] = { (char*)counts, (char*)measurements };
+	size_t sizes[2] = { sizeof(counts), sizeof(measurements) };
+	bool received = true;
+	for(int k = 0; k < 2 && received; k++) {
+		size_t done = 0;
+		while(done < sizes[k]) {
+			ssize_t got = read(channel[0], targets[k] + done, sizes[k] - done);
+			if(got <= 0) {
+				received = false;
+				break;
+			}
+			done += got;
+		}
+	}
+	close(channel[0]);
+	int status;
+	waitpid(child, &status, 0);
+	BenchmarkResult result;
+	result.configuration = configuration.name;
+	if(!received || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+		//The child failed part way through; report nothing rather than half a measurement
+		return result;
+	}
+	result.puzzles = counts[0];
+	result.solved = counts[1];
+	result.unsolvable = counts[2];
+	result.invalid = counts[3];
+	result.runs = counts[4];
+	result.peak_rss = counts[5];
+	result.seconds = measurements[0];
+	result.mean_latency = measurements[1];
+	result.p50_latency = measurements[2];
+	result.p99_latency = measurements[3];
+	result.max_latency = measurements[4];
+	result.nodes_per_puzzle = measurements[5];
+	return result;
+}
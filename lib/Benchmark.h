@@ -0,0 +1,132 @@
+/**
+ * @file Benchmark.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the Benchmark class, which times a set of solver configurations over a set
+ * of corpora in the one-puzzle-per-line format. Each corpus is read into memory before
+ * it is timed, and every puzzle is timed on its own (parsing plus search), so a run
+ * reports throughput along with the shape of the latency distribution: the mean, the
+ * median, the 99th percentile, and the worst case. The nodes each search visits are
+ * recorded as well.
+ *
+ * Each configuration is run in a child process forked for it, so the peak resident set
+ * size reported for a configuration is its own: every child starts out with the same
+ * memory (the benchmark's, corpus included), and no configuration's allocations are
+ * left behind for the next one to be charged with.
+ *
+ * Results can be written as a human-readable table or as JSON, for comparing runs.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+//Protected includes (for argument and return types)
+#include <iostream>
+#include <string>
+#include <vector>
+
+//Header includes (for member types)
+#include "Sudoku.h"
+
+using namespace std;
+
+//A named way of solving puzzles: a Sudoku object with its engine and search options,
+//or GridPuzzle, which runs the size-templated backtracker for grids of any size
+struct BenchmarkConfiguration {
+
+	string name;
+	Sudoku sudoku;
+	bool grid;
+
+	BenchmarkConfiguration(const string& name, const Sudoku& sudoku, bool grid = false)
+		: name(name), sudoku(sudoku), grid(grid) {}
+
+};
+
+//The measurements taken from one configuration over one corpus
+struct BenchmarkResult {
+
+	string corpus;
+	string configuration;
+	//Outcomes over one pass of the corpus
+	long puzzles;
+	long solved;
+	long unsolvable;
+	long invalid;
+	//Puzzles timed over every pass (invalid lines are never timed)
+	long runs;
+	//Time spent parsing and searching, summed over every timed puzzle, in seconds
+	double seconds;
+	//Per-puzzle latencies, in microseconds
+	double mean_latency;
+	double p50_latency;
+	double p99_latency;
+	double max_latency;
+	double nodes_per_puzzle;
+	//The resident set high-water mark of the process which ran the configuration, in
+	//kilobytes
+	long peak_rss;
+
+	BenchmarkResult() {
+		this->puzzles = 0;
+		this->solved = 0;
+		this->unsolvable = 0;
+		this->invalid = 0;
+		this->runs = 0;
+		this->seconds = 0;
+		this->mean_latency = 0;
+		this->p50_latency = 0;
+		this->p99_latency = 0;
+		this->max_latency = 0;
+		this->nodes_per_puzzle = 0;
+		this->peak_rss = 0;
+	}
+
+	double getPuzzlesPerSecond() const {
+		return (this->seconds > 0) ? (this->runs / this->seconds) : 0;
+	}
+
+};
+
+class Benchmark {
+
+private:
+
+	vector<BenchmarkConfiguration> configurations;
+	vector<BenchmarkResult> results;
+	//Number of times each puzzle is solved per configuration
+	int repeat;
+
+	BenchmarkResult runConfiguration(BenchmarkConfiguration& configuration, const vector<string>& puzzles);
+	BenchmarkResult runIsolated(BenchmarkConfiguration& configuration, const vector<string>& puzzles);
+
+public:
+
+	Benchmark();
+
+	int getRepeat() const;
+	void setRepeat(int repeat);
+	const vector<BenchmarkConfiguration>& getConfigurations() const;
+	const vector<BenchmarkResult>& getResults() const;
+
+	void addConfiguration(const string& name, const Sudoku& configuration);
+	void addGridConfiguration(const string& name);
+	void addDefaultConfigurations();
+	bool selectConfigurations(const vector<string>& names);
+
+	BenchmarkResult runCorpus(const string& corpus, const vector<string>& puzzles);
+	bool runFile(const string& path);
+
+	void writeTable(ostream& output) const;
+	void writeJson(ostream& output) const;
+
+	//Static helper functions
+	static double getPercentile(const vector<double>& sorted, double fraction);
+	static long getPeakResidentKilobytes();
+	static string getCorpusName(const string& path);
+	static bool readCorpus(const string& path, vector<string>& puzzles);
+
+};
+
+#endif
@@ -0,0 +1,527 @@
+/**
+ * @file BinaryFormat.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the BinaryFormat, BinaryWriter, and BinaryPuzzleReader
+ * classes. For details about the format and these classes, see 'BinaryFormat.h'.
+ */
+
+//Protected includes
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+//Header includes
+#include "BinaryFormat.h"
+#include "BatchSolver.h"
+
+using namespace std;
+
+const char BinaryFormat::MAGIC[4] = {'S', 'D', 'K', 'B'};
+const uint16_t BinaryFormat::VERSION;
+const size_t BinaryFormat::HEADER_SIZE;
+const size_t BinaryFormat::MASK_SIZE;
+const size_t BinaryFormat::DIGITS_SIZE;
+const size_t BinaryFormat::PUZZLE_RECORD_SIZE;
+const size_t BinaryFormat::SOLUTION_RECORD_SIZE;
+const uint64_t BinaryFormat::UNKNOWN_COUNT;
+const uint16_t BinaryFormat::HAS_INDEX;
+
+//Writes a little-endian number of the given width
+static void putNumber(uint8_t* bytes, uint64_t value, int width) {
+	for(int i = 0; i < width; i++) {
+		bytes[i] = (uint8_t)(value >> (8 * i));
+	}
+}
+
+//Reads a little-endian number of the given width
+static uint64_t getNumber(const uint8_t* bytes, int width) {
+	uint64_t value = 0;
+	for(int i = 0; i < width; i++) {
+		value |= (uint64_t)bytes[i] << (8 * i);
+	}
+	return value;
+}
+
+/*** BinaryHeader implementation ***/
+
+//Public constructor. Describes an empty file of puzzles, without an index.
+BinaryHeader::BinaryHeader() {
+	this->version = BinaryFormat::VERSION;
+	this->kind = BinaryFormat::PUZZLES;
+	this->record_size = BinaryFormat::PUZZLE_RECORD_SIZE;
+	this->flags = 0;
+	this->count = 0;
+	this->index_offset = 0;
+}
+
+//Writes the header's HEADER_SIZE bytes
+void BinaryHeader::encode(uint8_t* bytes) const {
+	memset(bytes, 0, BinaryFormat::HEADER_SIZE);
+	memcpy(bytes, BinaryFormat::MAGIC, 4);
+	putNumber(bytes + 4, this->version, 2);
+	putNumber(bytes + 6, this->kind, 2);
+	putNumber(bytes + 8, this->record_size, 2);
+	putNumber(bytes + 10, this->flags, 2);
+	putNumber(bytes + 12, this->count, 8);
+	putNumber(bytes + 20, this->index_offset, 8);
+}
+
+/**
+ * Reads a header from the start of a file. Returns false if the bytes are not the
+ * header of a binary corpus this version can read.
+ *
+ * @param 	bytes 	The first bytes of a file
+ * @param 	length 	The number of bytes available
+ */
+bool BinaryHeader::decode(const uint8_t* bytes, size_t length) {
+	if(length < BinaryFormat::HEADER_SIZE || memcmp(bytes, BinaryFormat::MAGIC, 4) != 0) {
+		return false;
+	}
+	this->version = (uint16_t)getNumber(bytes + 4, 2);
+	this->kind = (uint16_t)getNumber(bytes + 6, 2);
+	this->record_size = (uint16_t)getNumber(bytes + 8, 2);
+	this->flags = (uint16_t)getNumber(bytes + 10, 2);
+	this->count = getNumber(bytes + 12, 8);
+	this->index_offset = getNumber(bytes + 20, 8);
+	return this->version == BinaryFormat::VERSION &&
+		   (this->kind == BinaryFormat::PUZZLES || this->kind == BinaryFormat::SOLUTIONS) &&
+		   this->record_size == BinaryFormat::getRecordSize((BinaryFormat::Kind)this->kind);
+}
+
+/*** BinaryFormat implementation ***/
+
+//Returns the size of a record of the given kind, in bytes
+size_t BinaryFormat::getRecordSize(Kind kind) {
+	return (kind == SOLUTIONS) ? SOLUTION_RECORD_SIZE : PUZZLE_RECORD_SIZE;
+}
+
+/**
+ * Encodes a puzzle record: the givens bitmask, then the packed digits. The solution
+ * fills in the cells that aren't givens only if the status is SOLVED.
+ *
+ * @param 	puzzle 		The puzzle (holding only digits and missing values)
+ * @param 	solution 	The puzzle's solution (ignored unless the status is SOLVED)
+ * @param 	status 		What is known about the puzzle
+ * @param 	record 		Receives the PUZZLE_RECORD_SIZE bytes of the record
+ */
+void BinaryFormat::encodePuzzle(const Board& puzzle, const Board& solution, Status status, uint8_t* record) {
+	memset(record, 0, MASK_SIZE);
+	for(int i = 0; i < 81; i++) {
+		if(!puzzle.isEmpty(i)) {
+			record[i >> 3] |= (uint8_t)(1 << (i & 7));
+		}
+	}
+	packDigits((status == SOLVED) ? solution : puzzle, status, record + MASK_SIZE);
+}
+
+/**
+ * Decodes a puzzle record, returning its status.
+ *
+ * @param 	record 		The bytes of a puzzle record
+ * @param 	puzzle 		Receives the givens
+ * @param 	solution 	Receives the solution, if the status is SOLVED
+ */
+BinaryFormat::Status BinaryFormat::decodePuzzle(const uint8_t* record, Board& puzzle, Board& solution) {
+	Status status = unpackDigits(record + MASK_SIZE, solution);
+	for(int i = 0; i < 81; i++) {
+		bool given = (record[i >> 3] >> (i & 7)) & 1;
+		uint8_t digit = solution.get(i);
+		//A given must hold a digit
+		puzzle.set(i, given ? ((digit != 0) ? digit : Board::INVALID) : 0);
+	}
+	return status;
+}
+
+/**
+ * Encodes a solution record.
+ *
+ * @param 	solution 	The solution (ignored unless the status is SOLVED)
+ * @param 	status 		What is known about the puzzle
+ * @param 	record 		Receives the SOLUTION_RECORD_SIZE bytes of the record
+ */
+void BinaryFormat::encodeSolution(const Board& solution, Status status, uint8_t* record) {
+	packDigits((status == SOLVED) ? solution : Board(), status, record);
+}
+
+/**
+ * Decodes a solution record, returning its status.
+ *
+ * @param 	record 		The bytes of a solution record
+ * @param 	solution 	Receives the solution
+ */
+BinaryFormat::Status BinaryFormat::decodeSolution(const uint8_t* record, Board& solution) {
+	return unpackDigits(record, solution);
+}
+
+//Returns whether a run of bytes begins with the magic number of a binary corpus
+bool BinaryFormat::isBinary(const char* data, size_t length) {
+	return length >= 4 && memcmp(data, MAGIC, 4) == 0;
+}
+
+//Returns whether the file at a path is a binary corpus (judging by its magic number)
+bool BinaryFormat::isBinaryFile(const string& path) {
+	ifstream input(path.c_str(), ios::binary);
+	char magic[4];
+	return input.read(magic, 4) && isBinary(magic, 4);
+}
+
+/**
+ * Converts a corpus in the one-line text format into a binary file of puzzles, one
+ * record per puzzle line (blank lines and comments are skipped; a line that isn't a
+ * well-formed puzzle is kept as an INVALID record). Returns the number of records.
+ *
+ * @param 	input 		The text corpus
+ * @param 	output 		The stream receiving the binary corpus
+ * @param 	indexed 	Whether to record the source line of every record
+ */
+long BinaryFormat::convertToBinary(istream& input, ostream& output, bool indexed) {
+	BinaryWriter writer(output, PUZZLES, indexed);
+	string line;
+	uint64_t number = 0;
+	Board puzzle;
+	while(getline(input, line)) {
+		number++;
+		if(!line.empty() && line[line.size() - 1] == '\r') {
+			line.erase(line.size() - 1);
+		}
+		if(BatchSolver::isSkippedLine(line)) {
+			continue;
+		}
+		bool valid = BatchSolver::isPuzzleLine(line);
+		if(valid) {
+			puzzle.parse(line.data(), line.size());
+		} else {
+			puzzle = Board();
+		}
+		writer.addPuzzle(puzzle, puzzle, valid ? UNSOLVED : INVALID, number);
+	}
+	writer.finish();
+	return (long)writer.getCount();
+}
+
+/*** Private method implementations ***/
+
+//Packs the 81 cells of a board two to a byte, with the status in the last nibble
+void BinaryFormat::packDigits(const Board& board, Status status, uint8_t* digits) {
+	for(int k = 0; k < 40; k++) {
+		digits[k] = (uint8_t)(board.get(2 * k) | (board.get((2 * k) + 1) << 4));
+	}
+	digits[40] = (uint8_t)(board.get(80) | (status << 4));
+}
+
+//Unpacks the cells of a board (a nibble above nine reads as Board::INVALID), returning
+//the status held in the last nibble
+BinaryFormat::Status BinaryFormat::unpackDigits(const uint8_t* digits, Board& board) {
+	for(int i = 0; i < 81; i++) {
+		uint8_t nibble = (digits[i >> 1] >> ((i & 1) * 4)) & 0x0F;
+		board.set(i, (nibble <= 9) ? nibble : Board::INVALID);
+	}
+	uint8_t status = digits[40] >> 4;
+	return (status <= INVALID) ? (Status)status : INVALID;
+}
+
+/*** BinaryWriter implementation ***/
+
+/**
+ * Public constructor. Writes the header straight away (with the count left unknown,
+ * until the writer is finished).
+ *
+ * @param 	output 		The stream receiving the file
+ * @param 	kind 		The kind of record to write
+ * @param 	indexed 	Whether to write an index (only on a stream that can seek)
+ */
+BinaryWriter::BinaryWriter(ostream& output, BinaryFormat::Kind kind, bool indexed) : output(output) {
+	this->kind = kind;
+	this->seekable = output.tellp() == (streampos)0;
+	this->indexed = indexed && this->seekable;
+	this->count = 0;
+	this->record.resize(BinaryFormat::getRecordSize(kind));
+	writeHeader(output, kind, BinaryFormat::UNKNOWN_COUNT, 0);
+}
+
+//Returns the number of records written so far
+uint64_t BinaryWriter::getCount() const {
+	return this->count;
+}
+
+/**
+ * Writes a record for a puzzle (or, in a file of solutions, for its solution).
+ *
+ * @param 	puzzle 		The puzzle
+ * @param 	solution 	The puzzle's solution (ignored unless the status is SOLVED)
+ * @param 	status 		What is known about the puzzle
+ * @param 	line 		The source line of the puzzle, for the index
+ */
+void BinaryWriter::addPuzzle(const Board& puzzle, const Board& solution, BinaryFormat::Status status, uint64_t line) {
+	if(this->kind == BinaryFormat::SOLUTIONS) {
+		this->addSolution(solution, status, line);
+		return;
+	}
+	BinaryFormat::encodePuzzle(puzzle, solution, status, this->record.data());
+	this->output.write((const char*)this->record.data(), this->record.size());
+	if(this->indexed) {
+		this->index.push_back(line);
+	}
+	this->count++;
+}
+
+/**
+ * Writes a solution record (in a file of puzzles, the puzzle is taken to be empty).
+ *
+ * @param 	solution 	The solution (ignored unless the status is SOLVED)
+ * @param 	status 		What is known about the puzzle
+ * @param 	line 		The source line of the puzzle, for the index
+ */
+void BinaryWriter::addSolution(const Board& solution, BinaryFormat::Status status, uint64_t line) {
+	if(this->kind == BinaryFormat::PUZZLES) {
+		this->addPuzzle(Board(), solution, status, line);
+		return;
+	}
+	BinaryFormat::encodeSolution(solution, status, this->record.data());
+	this->output.write((const char*)this->record.data(), this->record.size());
+	if(this->indexed) {
+		this->index.push_back(line);
+	}
+	this->count++;
+}
+
+/**
+ * Writes the index, if one was kept, and rewrites the header with the final count if
+ * the stream can seek. Returns false if anything could not be written.
+ */
+bool BinaryWriter::finish() {
+	if(this->seekable) {
+		uint64_t index_offset = 0;
+		if(this->indexed) {
+			index_offset = BinaryFormat::HEADER_SIZE + (this->count * this->record.size());
+			uint8_t entry[8];
+			for(size_t i = 0; i < this->index.size(); i++) {
+				putNumber(entry, this->index[i], 8);
+				this->output.write((const char*)entry, 8);
+			}
+		}
+		streampos end = this->output.tellp();
+		this->output.seekp(0);
+		writeHeader(this->output, this->kind, this->count, index_offset);
+		this->output.seekp(end);
+	}
+	this->output.flush();
+	return this->output.good();
+}
+
+/**
+ * Writes a header to a stream.
+ *
+ * @param 	output 			The stream receiving the header
+ * @param 	kind 			The kind of record the file holds
+ * @param 	count 			The number of records, or UNKNOWN_COUNT
+ * @param 	index_offset 	The offset of the index, or zero for none
+ */
+void BinaryWriter::writeHeader(ostream& output, BinaryFormat::Kind kind, uint64_t count, uint64_t index_offset) {
+	BinaryHeader header;
+	header.kind = kind;
+	header.record_size = BinaryFormat::getRecordSize(kind);
+	header.flags = (index_offset != 0) ? BinaryFormat::HAS_INDEX : 0;
+	header.count = count;
+	header.index_offset = index_offset;
+	uint8_t bytes[BinaryFormat::HEADER_SIZE];
+	header.encode(bytes);
+	output.write((const char*)bytes, BinaryFormat::HEADER_SIZE);
+}
+
+/*** BinaryPuzzleReader implementation ***/
+
+//Public constructor. The reader starts out closed.
+BinaryPuzzleReader::BinaryPuzzleReader() {
+	this->mapping = NULL;
+	this->length = 0;
+	this->count = 0;
+	this->cursor = 0;
+}
+
+BinaryPuzzleReader::~BinaryPuzzleReader() {
+	this->close();
+}
+
+/**
+ * Maps a binary corpus file into memory, closing any file mapped before. Returns false
+ * if the file can't be mapped, or doesn't begin with a valid header. A file whose count
+ * is unknown (or larger than the file) is read up to its last whole record.
+ *
+ * @param 	path 	The path of the corpus
+ */
+bool BinaryPuzzleReader::open(const string& path) {
+	this->close();
+	int descriptor = ::open(path.c_str(), O_RDONLY);
+	if(descriptor < 0) {
+		return false;
+	}
+	struct stat info;
+	if(fstat(descriptor, &info) != 0 || !S_ISREG(info.st_mode) || (size_t)info.st_size < BinaryFormat::HEADER_SIZE) {
+		::close(descriptor);
+		return false;
+	}
+	size_t size = (size_t)info.st_size;
+	void* address = mmap(NULL, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+	::close(descriptor);
+	if(address == MAP_FAILED) {
+		return false;
+	}
+	this->mapping = (const uint8_t*)address;
+	this->length = size;
+	if(!this->header.decode(this->mapping, this->length)) {
+		this->close();
+		return false;
+	}
+	//An index that lies outside the file, overlaps the header, or doesn't cover every
+	//record before it is ignored, and the records run to the end of the file
+	if(this->hasIndex()) {
+		uint64_t offset = this->header.index_offset;
+		if(offset < BinaryFormat::HEADER_SIZE || offset > size ||
+		   (size - offset) / 8 < this->countRecords(offset)) {
+			this->header.flags &= ~BinaryFormat::HAS_INDEX;
+		}
+	}
+	this->count = this->countRecords(this->hasIndex() ? this->header.index_offset : size);
+	madvise(address, this->length, MADV_SEQUENTIAL);
+	return true;
+}
+
+//Unmaps the corpus
+void BinaryPuzzleReader::close() {
+	if(this->mapping != NULL) {
+		munmap((void*)this->mapping, this->length);
+	}
+	this->mapping = NULL;
+	this->length = 0;
+	this->count = 0;
+	this->cursor = 0;
+	this->header = BinaryHeader();
+}
+
+bool BinaryPuzzleReader::isOpen() const {
+	return this->mapping != NULL;
+}
+
+//Returns the kind of record the file holds
+BinaryFormat::Kind BinaryPuzzleReader::getKind() const {
+	return (BinaryFormat::Kind)this->header.kind;
+}
+
+//Returns the number of records in the file
+uint64_t BinaryPuzzleReader::getCount() const {
+	return this->count;
+}
+
+//Returns whether the file has an index of source lines
+bool BinaryPuzzleReader::hasIndex() const {
+	return (this->header.flags & BinaryFormat::HAS_INDEX) != 0;
+}
+
+//Returns the source line of the record at a position, or zero if there is no index
+uint64_t BinaryPuzzleReader::getLine(uint64_t position) const {
+	if(!this->hasIndex() || position >= this->count) {
+		return 0;
+	}
+	return getNumber(this->mapping + this->header.index_offset + (position * 8), 8);
+}
+
+//Moves to the record at a position, which next() will yield (for reading a shard)
+void BinaryPuzzleReader::seek(uint64_t position) {
+	this->cursor = (position < this->count) ? position : this->count;
+}
+
+/**
+ * Decodes the record at a position, returning its status. In a file of solutions, the
+ * puzzle is left empty.
+ *
+ * @param 	position 	The position of the record, counting from zero
+ * @param 	puzzle 		Receives the puzzle
+ * @param 	solution 	Receives the solution, if the status is SOLVED
+ */
+BinaryFormat::Status BinaryPuzzleReader::read(uint64_t position, Board& puzzle, Board& solution) const {
+	const uint8_t* record = this->mapping + BinaryFormat::HEADER_SIZE + (position * this->header.record_size);
+	if(this->getKind() == BinaryFormat::SOLUTIONS) {
+		puzzle = Board();
+		return BinaryFormat::decodeSolution(record, solution);
+	}
+	return BinaryFormat::decodePuzzle(record, puzzle, solution);
+}
+
+/**
+ * Decodes the next record straight into the view's board: the puzzle of a puzzle
+ * record, or the solution of a solved solution record. A record with nothing to solve
+ * (an invalid one, or an unsolvable solution) is given as a line of text instead,
+ * "invalid" or "unsolvable", copied into the storage string.
+ */
+bool BinaryPuzzleReader::next(PuzzleView& view, string& storage) {
+	if(this->cursor >= this->count) {
+		return false;
+	}
+	Board solution;
+	BinaryFormat::Status status;
+	if(this->getKind() == BinaryFormat::SOLUTIONS) {
+		Board puzzle;
+		status = this->read(this->cursor++, puzzle, view.board);
+	} else {
+		status = this->read(this->cursor++, view.board, solution);
+	}
+	view.decoded = status != BinaryFormat::INVALID &&
+				   (this->getKind() != BinaryFormat::SOLUTIONS || status != BinaryFormat::UNSOLVABLE);
+	if(view.decoded) {
+		view.data = NULL;
+		view.size = 0;
+		return true;
+	}
+	storage = (status == BinaryFormat::INVALID) ? "invalid" : "unsolvable";
+	view.data = storage.data();
+	view.size = storage.size();
+	return true;
+}
+
+/**
+ * Converts a binary corpus to text, one line per record (see next(); decoded boards are
+ * written in the one-line format), from the reader's current position. Returns the
+ * number of lines written.
+ *
+ * @param 	input 	A reader open on a binary corpus
+ * @param 	output 	The stream receiving the text
+ */
+long BinaryPuzzleReader::convertToText(BinaryPuzzleReader& input, ostream& output) {
+	long lines = 0;
+	PuzzleView view;
+	string storage;
+	while(input.next(view, storage)) {
+		if(view.decoded) {
+			storage.resize(81);
+			for(int i = 0; i < 81; i++) {
+				uint8_t value = view.board.get(i);
+				storage[i] = (value == 0) ? '.' : (value <= 9) ? (char)('0' + value) : '?';
+			}
+			output.write(storage.data(), storage.size());
+		} else {
+			output.write(view.data, view.size);
+		}
+		output.put('\n');
+		lines++;
+	}
+	output.flush();
+	return lines;
+}
+
+/**
+ * Returns the number of records the reader yields when they end at the given offset:
+ * the count in the header, or the number of whole records that fit if that's fewer.
+ *
+ * @param 	end 	The offset at which the records end, no less than the header's size
+ */
+uint64_t BinaryPuzzleReader::countRecords(uint64_t end) const {
+	uint64_t available = (end - BinaryFormat::HEADER_SIZE) / this->header.record_size;
+	return (this->header.count < available) ? this->header.count : available;
+}
@@ -0,0 +1,198 @@
+/**
+ * @file BinaryFormat.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the binary corpus format, a compact alternative to the one-line text format
+ * whose records are all the same size, so that the record at any position (and any
+ * shard of a corpus) can be found by arithmetic rather than by scanning.
+ *
+ * A file is a 32-byte header followed by its records, and optionally by an index. All
+ * numbers are little-endian. The header holds:
+ *
+ *     bytes 0-3     the magic number "SDKB"
+ *     bytes 4-5     the format version (1)
+ *     bytes 6-7     the kind of record: 1 for puzzles, 2 for solutions
+ *     bytes 8-9     the record size, in bytes
+ *     bytes 10-11   flags (bit 0: the file has an index)
+ *     bytes 12-19   the number of records, or all ones if the file was written as a
+ *                   stream and the count is unknown (the records then run to the end
+ *                   of the file)
+ *     bytes 20-27   the offset of the index, or zero
+ *     bytes 28-31   reserved (zero)
+ *
+ * Digits are packed two to a byte, cell 2k in the low nibble of byte k and cell 2k+1 in
+ * the high nibble, 81 cells taking 40.5 bytes; the spare high nibble of the 41st byte
+ * holds the record's status (see BinaryFormat::Status). A puzzle record (52 bytes) is
+ * an 11-byte bitmask of the givens (bit i of the mask is cell i, least significant bit
+ * first) followed by the packed digits: the givens, and, once the puzzle is solved, its
+ * solution in the other cells. A solution record (41 bytes) is the packed digits alone,
+ * all zero unless the status is SOLVED.
+ *
+ * The index, written when a text corpus is converted, holds one 8-byte entry per record:
+ * the line of the source corpus (counting from 1) that the record came from.
+ */
+
+#ifndef BINARY_FORMAT_H
+#define BINARY_FORMAT_H
+
+//Protected includes (for argument, return, and member types)
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//Header includes (for argument and base types)
+#include "Board.h"
+#include "PuzzleReader.h"
+
+using namespace std;
+
+//The fields of a binary corpus file's header
+struct BinaryHeader {
+
+	uint16_t version;
+	uint16_t kind;
+	uint16_t record_size;
+	uint16_t flags;
+	uint64_t count;
+	uint64_t index_offset;
+
+	BinaryHeader();
+
+	void encode(uint8_t* bytes) const;
+	bool decode(const uint8_t* bytes, size_t length);
+
+};
+
+class BinaryFormat {
+
+public:
+
+	//The kinds of record a file can hold
+	enum Kind {
+		PUZZLES = 1,
+		SOLUTIONS = 2
+	};
+
+	//What a record says about its puzzle
+	enum Status {
+		UNSOLVED = 0,
+		SOLVED = 1,
+		UNSOLVABLE = 2,
+		//The source line was not a well-formed puzzle
+		INVALID = 3
+	};
+
+	static const char MAGIC[4];
+	static const uint16_t VERSION = 1;
+	static const size_t HEADER_SIZE = 32;
+	static const size_t MASK_SIZE = 11;
+	static const size_t DIGITS_SIZE = 41;
+	static const size_t PUZZLE_RECORD_SIZE = MASK_SIZE + DIGITS_SIZE;
+	static const size_t SOLUTION_RECORD_SIZE = DIGITS_SIZE;
+	//Stored as the count of a file written as a stream
+	static const uint64_t UNKNOWN_COUNT = ~(uint64_t)0;
+	static const uint16_t HAS_INDEX = 1;
+
+	//Static helper functions
+	static size_t getRecordSize(Kind kind);
+	static void encodePuzzle(const Board& puzzle, const Board& solution, Status status, uint8_t* record);
+	static Status decodePuzzle(const uint8_t* record, Board& puzzle, Board& solution);
+	static void encodeSolution(const Board& solution, Status status, uint8_t* record);
+	static Status decodeSolution(const uint8_t* record, Board& solution);
+	static bool isBinary(const char* data, size_t length);
+	static bool isBinaryFile(const string& path);
+	static long convertToBinary(istream& input, ostream& output, bool indexed);
+
+private:
+
+	static void packDigits(const Board& board, Status status, uint8_t* digits);
+	static Status unpackDigits(const uint8_t* digits, Board& board);
+
+};
+
+/**
+ * Writes a binary corpus to a stream, one record at a time. If the stream can seek
+ * (as a file can), the header is rewritten with the final count once the writer is
+ * finished, and an index can be kept; otherwise the count is left unknown.
+ */
+class BinaryWriter {
+
+private:
+
+	ostream& output;
+	BinaryFormat::Kind kind;
+	bool indexed;
+	bool seekable;
+	uint64_t count;
+	vector<uint64_t> index;
+	vector<uint8_t> record;
+
+public:
+
+	BinaryWriter(ostream& output, BinaryFormat::Kind kind, bool indexed = false);
+
+	uint64_t getCount() const;
+
+	void addPuzzle(const Board& puzzle, const Board& solution, BinaryFormat::Status status, uint64_t line = 0);
+	void addSolution(const Board& solution, BinaryFormat::Status status, uint64_t line = 0);
+	bool finish();
+
+	//Static helper function
+	static void writeHeader(ostream& output, BinaryFormat::Kind kind, uint64_t count, uint64_t index_offset);
+
+};
+
+/**
+ * Yields the records of a binary corpus file, so that a binary corpus can be solved by
+ * anything that takes a PuzzleReader. The file is mapped into memory; records can also
+ * be read directly by position.
+ *
+ * Records are decoded straight into the view's board, with no text to parse: a puzzle
+ * record yields its givens, and a solution record its solution (an empty board if its
+ * status is UNSOLVED). Only two kinds of record come back as text: one marked INVALID
+ * yields the line "invalid", which is not a puzzle line, so a batch reports it as
+ * invalid again; and a solution record marked UNSOLVABLE yields "unsolvable".
+ */
+class BinaryPuzzleReader : public PuzzleReader {
+
+private:
+
+	const uint8_t* mapping;
+	size_t length;
+	BinaryHeader header;
+	uint64_t count;
+	//Position of the next record to yield
+	uint64_t cursor;
+
+	uint64_t countRecords(uint64_t end) const;
+
+	//Not copyable: the reader owns its mapping
+	BinaryPuzzleReader(const BinaryPuzzleReader& other);
+	BinaryPuzzleReader& operator=(const BinaryPuzzleReader& other);
+
+public:
+
+	BinaryPuzzleReader();
+	~BinaryPuzzleReader();
+
+	bool open(const string& path);
+	void close();
+	bool isOpen() const;
+	BinaryFormat::Kind getKind() const;
+	uint64_t getCount() const;
+	bool hasIndex() const;
+	uint64_t getLine(uint64_t position) const;
+	void seek(uint64_t position);
+
+	BinaryFormat::Status read(uint64_t position, Board& puzzle, Board& solution) const;
+	bool next(PuzzleView& view, string& storage);
+
+	//Static helper function
+	static long convertToText(BinaryPuzzleReader& input, ostream& output);
+
+};
+
+#endif
@@ -0,0 +1,138 @@
+/**
+ * @file Board.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the Board class, a compact value type holding the 81 cells of a game as
+ * bytes: zero for a missing value, otherwise the digit. A board is 81 bytes, lives
+ * inline in whatever holds it (no heap allocation), and is trivially copyable, so it
+ * can be copied with memcpy, passed between threads, and handed straight to the
+ * vectorized routines in BoardKernels.
+ *
+ * The board's geometry (the row, column, and box of every cell, the cells of every unit,
+ * and the peers of every cell) is that of any 9x9 grid, so Board::TABLES refers to the
+ * tables of GridGeometry<3> rather than keeping a copy; only the character table used
+ * for parsing belongs to the board. Both are computed at compile time.
+ */
+
+#ifndef BOARD_H
+#define BOARD_H
+
+//Protected includes (for argument, return, and member types)
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+//Header includes (for member types)
+#include "GridGeometry.h"
+
+using namespace std;
+
+//The geometry of a board
+typedef GridGeometry<3>::Tables BoardTables;
+
+struct BoardCharacters {
+
+	//The cell value of each character: '1'-'9' are digits, '.' and '0' are missing
+	//values, and anything else is Board::INVALID
+	uint8_t cell_of_char[256];
+
+	constexpr BoardCharacters() : cell_of_char() {
+		for(int c = 0; c < 256; c++) {
+			this->cell_of_char[c] = (c >= '1' && c <= '9') ? (uint8_t)(c - '0') :
+									(c == '.' || c == '0') ? 0 : 10;
+		}
+	}
+
+};
+
+class Board {
+
+private:
+
+	array<uint8_t, 81> cells;
+
+public:
+
+	//Stored for a character that is neither a digit nor a missing value; a board
+	//holding it is never valid
+	static const uint8_t INVALID = 10;
+
+	static constexpr const BoardTables& TABLES = GridGeometry<3>::TABLES;
+	static constexpr BoardCharacters CHARACTERS = BoardCharacters();
+
+	//Public constructor. The board starts out with every value missing.
+	Board() : cells() {}
+
+	uint8_t get(int index) const {
+		return this->cells[index];
+	}
+
+	void set(int index, uint8_t digit) {
+		this->cells[index] = digit;
+	}
+
+	void clear(int index) {
+		this->cells[index] = 0;
+	}
+
+	bool isEmpty(int index) const {
+		return this->cells[index] == 0;
+	}
+
+	const uint8_t* data() const {
+		return this->cells.data();
+	}
+
+	bool operator==(const Board& other) const {
+		return this->cells == other.cells;
+	}
+
+	bool operator!=(const Board& other) const {
+		return this->cells != other.cells;
+	}
+
+	/**
+	 * Reads a board from the one-line format, one table lookup per character. Missing
+	 * values may be written as '.' or '0'; cells past the end of a short string are
+	 * left missing, and characters past the 81st are ignored.
+	 *
+	 * @param 	state 	The first character of a Sudoku game string
+	 * @param 	length 	The number of characters in the game string
+	 */
+	void parse(const char* state, size_t length) {
+		size_t count = (length < 81) ? length : 81;
+		for(size_t i = 0; i < count; i++) {
+			this->cells[i] = CHARACTERS.cell_of_char[(unsigned char)state[i]];
+		}
+		for(size_t i = count; i < 81; i++) {
+			this->cells[i] = 0;
+		}
+	}
+
+	//Converts from the vector form used by older interfaces (-1 for a missing value)
+	void fromVector(const vector<int>& state) {
+		for(int i = 0; i < 81; i++) {
+			int value = (i < state.size()) ? state[i] : -1;
+			this->cells[i] = (value == -1) ? 0 : (value >= 1 && value <= 9) ? (uint8_t)value : INVALID;
+		}
+	}
+
+	//Converts to the vector form used by older interfaces (-1 for a missing value; an
+	//invalid cell reads as zero, as the old parser left it)
+	void toVector(vector<int>& state) const {
+		state.resize(81);
+		for(int i = 0; i < 81; i++) {
+			uint8_t value = this->cells[i];
+			state[i] = (value == 0) ? -1 : (value == INVALID) ? 0 : value;
+		}
+	}
+
+};
+
+static_assert(sizeof(Board) == 81, "Board must stay 81 bytes");
+static_assert(is_trivially_copyable<Board>::value, "Board must be trivially copyable");
+
+#endif
@@ -0,0 +1,318 @@
+/**
+ * @file BoardEditor.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the public interface and private methods of the
+ * BoardEditor class. For details about this class, see 'BoardEditor.h'.
+ */
+
+//Protected includes
+#include <cstring>
+#include <vector>
+
+//Header includes
+#include "BoardEditor.h"
+#include "Candidates.h"
+
+using namespace std;
+
+/*** Public interface implementation ***/
+
+//Public constructor. The editor starts out holding an empty board.
+BoardEditor::BoardEditor() {
+	this->load(Board());
+}
+
+/**
+ * Replaces the board being edited, rebuilding every count, mask, and set from scratch.
+ * Clears the edit history and forgets any remembered solution.
+ *
+ * @param 	board 	The board to edit
+ */
+void BoardEditor::load(const Board& board) {
+	this->cells = board;
+	memset(this->counts, 0, sizeof(this->counts));
+	memset(this->used, 0, sizeof(this->used));
+	this->filled = 0;
+	this->invalid = 0;
+	for(int i = 0; i < 81; i++) {
+		uint8_t digit = board.get(i);
+		if(digit == Board::INVALID) {
+			this->invalid++;
+		} else if(digit != 0) {
+			this->filled++;
+			int units[3] = {Board::TABLES.row_of[i], 9 + Board::TABLES.col_of[i], 18 + Board::TABLES.box_of[i]};
+			for(int u = 0; u < 3; u++) {
+				this->counts[units[u]][digit]++;
+				this->used[units[u]] |= Candidates::digitToMask(digit);
+			}
+		}
+	}
+	//Start every cell out neither conflicted nor dead, so refresh() counts each one
+	memset(this->conflicted, 0, sizeof(this->conflicted));
+	memset(this->dead, 0, sizeof(this->dead));
+	this->conflicts = 0;
+	this->dead_cells = 0;
+	for(int i = 0; i < 81; i++) {
+		this->refresh(i);
+	}
+	this->history.clear();
+	this->has_solution = false;
+	this->mismatches = 0;
+}
+
+//Public getter for the cells member
+const Board& BoardEditor::getCells() const {
+	return this->cells;
+}
+
+//Returns the value of a cell: zero if it is empty, otherwise its digit (or Board::INVALID)
+int BoardEditor::get(int index) const {
+	return this->cells.get(index);
+}
+
+/**
+ * Writes a digit into a cell (or, given zero, empties it), recording the edit so it can
+ * be undone. Digits in conflict with the cell's peers are allowed; the cells involved
+ * are added to the conflict set.
+ *
+ * @param 	index 	The index of the cell
+ * @param 	digit 	The digit to write (1-9), or zero to empty the cell
+ */
+void BoardEditor::set(int index, int digit) {
+	Edit edit;
+	edit.index = (uint8_t)index;
+	edit.previous = this->cells.get(index);
+	this->history.push_back(edit);
+	this->write(index, (uint8_t)digit);
+}
+
+/**
+ * Undoes the most recent edit not yet undone. Returns false if there is none;
+ * otherwise, the index of the cell it restored.
+ *
+ * @param 	index 	Receives the index of the restored cell
+ */
+bool BoardEditor::undo(int& index) {
+	if(this->history.empty()) {
+		return false;
+	}
+	Edit edit = this->history.back();
+	this->history.pop_back();
+	index = edit.index;
+	this->write(edit.index, edit.previous);
+	return true;
+}
+
+//Returns the number of edits that can be undone
+size_t BoardEditor::getHistorySize() const {
+	return this->history.size();
+}
+
+/**
+ * Returns a mask of the digits that could be written into an empty cell without a
+ * conflict (bit d - 1 for the digit d), or zero for a filled cell.
+ *
+ * @param 	index 	The index of the cell
+ */
+unsigned short BoardEditor::getCandidates(int index) const {
+	return this->cells.isEmpty(index) ? this->candidates[index] : 0;
+}
+
+//Returns whether a cell shares a unit with another cell holding the same digit
+bool BoardEditor::isConflicted(int index) const {
+	return this->conflicted[index];
+}
+
+//Returns the number of cells in conflict
+int BoardEditor::getConflictCount() const {
+	return this->conflicts;
+}
+
+/**
+ * Lists the cells in conflict, in ascending order.
+ *
+ * @param 	cells 	Receives the indices of the cells
+ */
+void BoardEditor::getConflicts(vector<int>& cells) const {
+	cells.clear();
+	for(int i = 0; i < 81 && (int)cells.size() < this->conflicts; i++) {
+		if(this->conflicted[i]) {
+			cells.push_back(i);
+		}
+	}
+}
+
+//Returns whether the board holds no conflicts and no invalid cells
+bool BoardEditor::isValid() const {
+	return this->conflicts == 0 && this->invalid == 0;
+}
+
+//Returns whether every cell is filled, without conflicts
+bool BoardEditor::isComplete() const {
+	return this->filled == 81 && this->conflicts == 0;
+}
+
+//Returns whether some empty cell has no candidates left (so the board can't be solved)
+bool BoardEditor::hasDeadCell() const {
+	return this->dead_cells > 0;
+}
+
+/**
+ * Looks for a cell whose digit is forced by the maintained candidates: a naked single
+ * (an empty cell with one candidate), or failing that a hidden single (a digit with only
+ * one possible cell in a unit). Returns false if there is neither.
+ *
+ * @param 	index 	Receives the index of the cell
+ * @param 	digit 	Receives the digit forced there
+ */
+bool BoardEditor::findSingle(int& index, int& digit) const {
+	for(int i = 0; i < 81; i++) {
+		if(this->cells.isEmpty(i) && Candidates::countDigits(this->candidates[i]) == 1) {
+			index = i;
+			digit = Candidates::lowestDigit(this->candidates[i]);
+			return true;
+		}
+	}
+	for(int u = 0; u < 27; u++) {
+		//Digits seen among the unit's empty cells once, and more than once
+		unsigned short once = 0;
+		unsigned short twice = 0;
+		for(int k = 0; k < 9; k++) {
+			int cell = Board::TABLES.units[u][k];
+			if(this->cells.isEmpty(cell)) {
+				twice |= once & this->candidates[cell];
+				once |= this->candidates[cell];
+			}
+		}
+		unsigned short hidden = once & ~twice & ~this->used[u];
+		if(hidden == 0) {
+			continue;
+		}
+		digit = Candidates::lowestDigit(hidden);
+		for(int k = 0; k < 9; k++) {
+			int cell = Board::TABLES.units[u][k];
+			if(this->cells.isEmpty(cell) && (this->candidates[cell] & Candidates::digitToMask(digit)) != 0) {
+				index = cell;
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+//Returns the empty cell with the fewest candidates, or -1 if no cell is empty
+int BoardEditor::findMostConstrained() const {
+	int best = -1;
+	int best_count = 10;
+	for(int i = 0; i < 81; i++) {
+		if(this->cells.isEmpty(i) && Candidates::countDigits(this->candidates[i]) < best_count) {
+			best = i;
+			best_count = Candidates::countDigits(this->candidates[i]);
+		}
+	}
+	return best;
+}
+
+/**
+ * Remembers a solution of the board. From then on, each edit keeps count of the filled
+ * cells disagreeing with it, until the next call to load().
+ *
+ * @param 	solution 	A complete, valid board extending the board being edited
+ */
+void BoardEditor::setSolution(const Board& solution) {
+	this->solution = solution;
+	this->has_solution = true;
+	this->mismatches = 0;
+	for(int i = 0; i < 81; i++) {
+		uint8_t digit = this->cells.get(i);
+		if(digit != 0 && digit != solution.get(i)) {
+			this->mismatches++;
+		}
+	}
+}
+
+//Returns whether a solution is remembered
+bool BoardEditor::hasSolution() const {
+	return this->has_solution;
+}
+
+//Returns whether a solution is remembered, and every filled cell agrees with it (so the
+//board can certainly still be solved)
+bool BoardEditor::agreesWithSolution() const {
+	return this->has_solution && this->mismatches == 0;
+}
+
+//Public getter for the solution member
+const Board& BoardEditor::getSolution() const {
+	return this->solution;
+}
+
+/*** Private method implementations ***/
+
+/**
+ * Writes a value into a cell without recording it, updating the unit counts and masks,
+ * then the state of the cell and each of its peers (the only cells whose units changed).
+ *
+ * @param 	index 	The index of the cell
+ * @param 	digit 	The value to write: zero, a digit, or Board::INVALID
+ */
+void BoardEditor::write(int index, uint8_t digit) {
+	uint8_t previous = this->cells.get(index);
+	if(previous == digit) {
+		return;
+	}
+	int units[3] = {Board::TABLES.row_of[index], 9 + Board::TABLES.col_of[index], 18 + Board::TABLES.box_of[index]};
+	if(previous == Board::INVALID) {
+		this->invalid--;
+	} else if(previous != 0) {
+		this->filled--;
+		for(int u = 0; u < 3; u++) {
+			if(--this->counts[units[u]][previous] == 0) {
+				this->used[units[u]] &= ~Candidates::digitToMask(previous);
+			}
+		}
+		if(this->has_solution && previous != this->solution.get(index)) {
+			this->mismatches--;
+		}
+	}
+	this->cells.set(index, digit);
+	if(digit == Board::INVALID) {
+		this->invalid++;
+	} else if(digit != 0) {
+		this->filled++;
+		for(int u = 0; u < 3; u++) {
+			this->counts[units[u]][digit]++;
+			this->used[units[u]] |= Candidates::digitToMask(digit);
+		}
+		if(this->has_solution && digit != this->solution.get(index)) {
+			this->mismatches++;
+		}
+	}
+	this->refresh(index);
+	for(int k = 0; k < 20; k++) {
+		this->refresh(Board::TABLES.peers[index][k]);
+	}
+}
+
+/**
+ * Recomputes a cell's candidates, and whether it is in conflict or dead, from the
+ * counts and masks of its units, adjusting the running totals.
+ *
+ * @param 	index 	The index of the cell
+ */
+void BoardEditor::refresh(int index) {
+	int row = Board::TABLES.row_of[index];
+	int col = 9 + Board::TABLES.col_of[index];
+	int square = 18 + Board::TABLES.box_of[index];
+	this->candidates[index] = Candidates::ALL_DIGITS & ~(this->used[row] | this->used[col] | this->used[square]);
+	uint8_t digit = this->cells.get(index);
+	bool conflicted = digit >= 1 && digit <= 9 &&
+					  (this->counts[row][digit] > 1 || this->counts[col][digit] > 1 || this->counts[square][digit] > 1);
+	bool dead = digit == 0 && this->candidates[index] == 0;
+	this->conflicts += (int)conflicted - (int)this->conflicted[index];
+	this->dead_cells += (int)dead - (int)this->dead[index];
+	this->conflicted[index] = conflicted;
+	this->dead[index] = dead;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file BoardEditor.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the BoardEditor class, which holds a board being edited one cell at a time
+ * (as by an interactive front end) along with state kept up to date by every edit: how
+ * many times each digit appears in each unit, the digits used by each unit, each cell's
+ * candidates, and the set of cells in conflict. An edit only touches the edited cell
+ * and its twenty peers, so it costs O(peers) rather than a pass over the board, and
+ * validity, conflicts, and candidates can be read back at any time without rescanning.
+ *
+ * Every edit is recorded, so edits can be undone in reverse order. The editor can also
+ * remember a solution of the board; it counts the filled cells disagreeing with that
+ * solution as edits are made, so whether the board can still reach it is known in O(1).
+ */
+
+#ifndef BOARD_EDITOR_H
+#define BOARD_EDITOR_H
+
+//Protected includes (for argument, return, and member types)
+#include <cstdint>
+#include <vector>
+
+//Header include (for member types)
+#include "Board.h"
+
+using namespace std;
+
+class BoardEditor {
+
+private:
+
+	//An edit, as needed to undo it: the cell, and the value it held before
+	struct Edit {
+		uint8_t index;
+		uint8_t previous;
+	};
+
+	Board cells;
+	//Occurrences of each digit in each unit (rows 0-8, columns 9-17, squares 18-26),
+	//and the digits used by each unit
+	uint8_t counts[27][10];
+	unsigned short used[27];
+	//The digits not used by any unit of each cell (whether or not the cell is filled)
+	unsigned short candidates[81];
+	//Whether each filled cell shares a unit with another cell holding its digit
+	bool conflicted[81];
+	int conflicts;
+	//Whether each empty cell has no candidates left
+	bool dead[81];
+	int dead_cells;
+	//Cells holding a digit, and cells holding Board::INVALID
+	int filled;
+	int invalid;
+	vector<Edit> history;
+	//A remembered solution, and the filled cells disagreeing with it
+	Board solution;
+	bool has_solution;
+	int mismatches;
+
+	void write(int index, uint8_t digit);
+	void refresh(int index);
+
+public:
+
+	BoardEditor();
+
+	void load(const Board& board);
+	const Board& getCells() const;
+	int get(int index) const;
+	void set(int index, int digit);
+	bool undo(int& index);
+	size_t getHistorySize() const;
+
+	unsigned short getCandidates(int index) const;
+	bool isConflicted(int index) const;
+	int getConflictCount() const;
+	void getConflicts(vector<int>& cells) const;
+	bool isValid() const;
+	bool isComplete() const;
+	bool hasDeadCell() const;
+	bool findSingle(int& index, int& digit) const;
+	int findMostConstrained() const;
+
+	void setSolution(const Board& solution);
+	bool hasSolution() const;
+	bool agreesWithSolution() const;
+	const Board& getSolution() const;
+
+};
+
+#endif
@@ -0,0 +1,345 @@
+/**
+ * @file BoardKernels.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the static methods of the BoardKernels class. For
+ * details about this class, see 'BoardKernels.h'.
+ */
+
+//Protected includes
+#include <cstring>
+
+//Header include
+#include "BoardKernels.h"
+
+//The vector kernels rely on GCC vector extensions, and on runtime CPU detection for x86
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BOARD_KERNELS_VECTORIZED 1
+#endif
+
+/*** Scalar kernels ***/
+
+static bool isValidScalar(const unsigned char* cells) {
+	unsigned short rows[9] = { 0 };
+	unsigned short cols[9] = { 0 };
+	unsigned short squares[9] = { 0 };
+	for(int i = 0; i < 81; i++) {
+		if(cells[i] == 0) {
+			continue;
+		}
+		if(cells[i] > 9) {
+			return false;
+		}
+		unsigned short bit = 1 << (cells[i] - 1);
+		int row = i / 9;
+		int col = i % 9;
+		int square = ((row / 3) * 3) + (col / 3);
+		if((rows[row] | cols[col] | squares[square]) & bit) {
+			return false;
+		}
+		rows[row] |= bit;
+		cols[col] |= bit;
+		squares[square] |= bit;
+	}
+	return true;
+}
+
+static void getCandidatesScalar(const unsigned char* cells, unsigned short* candidates) {
+	unsigned short rows[9] = { 0 };
+	unsigned short cols[9] = { 0 };
+	unsigned short squares[9] = { 0 };
+	for(int i = 0; i < 81; i++) {
+		if(cells[i] != 0) {
+			unsigned short bit = 1 << ((cells[i] - 1) & 15);
+			rows[i / 9] |= bit;
+			cols[i % 9] |= bit;
+			squares[(((i / 9) / 3) * 3) + ((i % 9) / 3)] |= bit;
+		}
+	}
+	for(int i = 0; i < 81; i++) {
+		int square = (((i / 9) / 3) * 3) + ((i % 9) / 3);
+		candidates[i] = (cells[i] != 0) ? 0 :
+						(0x1FF & ~(rows[i / 9] | cols[i % 9] | squares[square]));
+	}
+}
+
+#ifdef BOARD_KERNELS_VECTORIZED
+
+/*** Vector kernels ***/
+
+#include <immintrin.h>
+
+#define KERNEL_INLINE static inline __attribute__((always_inline))
+
+/**
+ * The reduced rows of a board. For each row, 'low' holds the digit bits of cells 0-7
+ * (bit d - 1 for the digit d, zero for a missing value) and lane 0 of 'high' holds those
+ * of cell 8. Lanes 0, 3, and 6 of 'thirds' hold the OR (or sum) of the row's cells
+ * within each of the three squares it crosses, and lane 0 of 'whole' that of the row.
+ */
+struct ReducedRows {
+	__m128i low[9];
+	__m128i high[9];
+	__m128i thirds_or[9];
+	__m128i thirds_sum[9];
+	__m128i whole_or[9];
+	__m128i whole_sum[9];
+};
+
+//Lookup tables for the low and high bytes of each digit's bit, indexed by digit. Bytes
+//from 10 to 15 get bit 15, which marks the board invalid; larger bytes are clamped to 15.
+#define LOW_BYTE_TABLE(set) set(0, 1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0)
+#define HIGH_BYTE_TABLE(set) set(0, 0, 0, 0, 0, 0, 0, 0, 0, 1, (char)128, (char)128, \
+								 (char)128, (char)128, (char)128, (char)128)
+
+__attribute__((target("ssse3")))
+KERNEL_INLINE void reduceRow(__m128i raw, ReducedRows& rows, int row) {
+	raw = _mm_min_epu8(raw, _mm_set1_epi8(15));
+	__m128i low_bytes = _mm_shuffle_epi8(LOW_BYTE_TABLE(_mm_setr_epi8), raw);
+	__m128i high_bytes = _mm_shuffle_epi8(HIGH_BYTE_TABLE(_mm_setr_epi8), raw);
+	__m128i low = _mm_unpacklo_epi8(low_bytes, high_bytes);
+	//Cells past the eighth belong to the next row
+	__m128i high = _mm_and_si128(_mm_unpackhi_epi8(low_bytes, high_bytes), _mm_setr_epi16(-1, 0, 0, 0, 0, 0, 0, 0));
+	//Fold cells 3k to 3k + 2 into lane 3k, moving cell 8 up into lane 6
+	__m128i last = _mm_slli_si128(high, 12);
+	__m128i thirds_or = _mm_or_si128(_mm_or_si128(low, _mm_srli_si128(low, 2)),
+									 _mm_or_si128(_mm_srli_si128(low, 4), last));
+	__m128i thirds_sum = _mm_add_epi16(_mm_add_epi16(low, _mm_srli_si128(low, 2)),
+									   _mm_add_epi16(_mm_srli_si128(low, 4), last));
+	rows.low[row] = low;
+	rows.high[row] = high;
+	rows.thirds_or[row] = thirds_or;
+	rows.thirds_sum[row] = thirds_sum;
+	rows.whole_or[row] = _mm_or_si128(thirds_or, _mm_or_si128(_mm_srli_si128(thirds_or, 6),
+																_mm_srli_si128(thirds_or, 12)));
+	rows.whole_sum[row] = _mm_add_epi16(thirds_sum, _mm_add_epi16(_mm_srli_si128(thirds_sum, 6),
+																   _mm_srli_si128(thirds_sum, 12)));
+}
+
+//Reduces the rows of a board one at a time in 128-bit registers
+__attribute__((target("ssse3")))
+KERNEL_INLINE void reduceRows(const unsigned char* cells, ReducedRows& rows) {
+	//Sixteen bytes are loaded per row, so pad the board out
+	unsigned char padded[96] = { 0 };
+	memcpy(padded, cells, 81);
+	for(int row = 0; row < 9; row++) {
+		reduceRow(_mm_loadu_si128((const __m128i*)(padded + (row * 9))), rows, row);
+	}
+}
+
+//Reduces the rows of a board two at a time, one in each half of a 256-bit register
+__attribute__((target("avx2")))
+KERNEL_INLINE void reduceRowPairs(const unsigned char* cells, ReducedRows& rows) {
+	unsigned char padded[112] = { 0 };
+	memcpy(padded, cells, 81);
+	const __m256i CLAMP = _mm256_set1_epi8(15);
+	const __m256i LOW_TABLE = _mm256_setr_m128i(
+		LOW_BYTE_TABLE(_mm_setr_epi8), LOW_BYTE_TABLE(_mm_setr_epi8));
+	const __m256i HIGH_TABLE = _mm256_setr_m128i(
+		HIGH_BYTE_TABLE(_mm_setr_epi8), HIGH_BYTE_TABLE(_mm_setr_epi8));
+	const __m256i LANE_0 = _mm256_setr_epi16(-1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0);
+	for(int row = 0; row < 9; row += 2) {
+		__m256i raw = _mm256_loadu2_m128i((const __m128i*)(padded + ((row + 1) * 9)),
+										  (const __m128i*)(padded + (row * 9)));
+		raw = _mm256_min_epu8(raw, CLAMP);
+		__m256i low_bytes = _mm256_shuffle_epi8(LOW_TABLE, raw);
+		__m256i high_bytes = _mm256_shuffle_epi8(HIGH_TABLE, raw);
+		__m256i low = _mm256_unpacklo_epi8(low_bytes, high_bytes);
+		__m256i high = _mm256_and_si256(_mm256_unpackhi_epi8(low_bytes, high_bytes), LANE_0);
+		__m256i last = _mm256_slli_si256(high, 12);
+		__m256i thirds_or = _mm256_or_si256(_mm256_or_si256(low, _mm256_srli_si256(low, 2)),
+											_mm256_or_si256(_mm256_srli_si256(low, 4), last));
+		__m256i thirds_sum = _mm256_add_epi16(_mm256_add_epi16(low, _mm256_srli_si256(low, 2)),
+											  _mm256_add_epi16(_mm256_srli_si256(low, 4), last));
+		__m256i whole_or = _mm256_or_si256(thirds_or, _mm256_or_si256(_mm256_srli_si256(thirds_or, 6),
+																		 _mm256_srli_si256(thirds_or, 12)));
+		__m256i whole_sum = _mm256_add_epi16(thirds_sum, _mm256_add_epi16(_mm256_srli_si256(thirds_sum, 6),
+																		   _mm256_srli_si256(thirds_sum, 12)));
+		//The last pair's upper half is padding, and is never stored
+		int count = (row == 8) ? 1 : 2;
+		for(int half = 0; half < count; half++) {
+			rows.low[row + half] = half ? _mm256_extracti128_si256(low, 1) : _mm256_castsi256_si128(low);
+			rows.high[row + half] = half ? _mm256_extracti128_si256(high, 1) : _mm256_castsi256_si128(high);
+			rows.thirds_or[row + half] = half ? _mm256_extracti128_si256(thirds_or, 1) : _mm256_castsi256_si128(thirds_or);
+			rows.thirds_sum[row + half] = half ? _mm256_extracti128_si256(thirds_sum, 1) : _mm256_castsi256_si128(thirds_sum);
+			rows.whole_or[row + half] = half ? _mm256_extracti128_si256(whole_or, 1) : _mm256_castsi256_si128(whole_or);
+			rows.whole_sum[row + half] = half ? _mm256_extracti128_si256(whole_sum, 1) : _mm256_castsi256_si128(whole_sum);
+		}
+	}
+}
+
+/**
+ * Reduces the columns and squares of a board from its reduced rows. Afterwards lanes 0-7
+ * of col_or/col_sum hold columns 0-7, lane 0 of last_or/last_sum holds column 8, and
+ * lanes 0, 3, and 6 of band_or/band_sum hold the three squares of each band.
+ */
+KERNEL_INLINE void reduceColumnsAndSquares(const ReducedRows& rows,
+										   __m128i& col_or, __m128i& col_sum,
+										   __m128i& last_or, __m128i& last_sum,
+										   __m128i* band_or, __m128i* band_sum) {
+	col_or = col_sum = last_or = last_sum = _mm_setzero_si128();
+	for(int band = 0; band < 3; band++) {
+		band_or[band] = band_sum[band] = _mm_setzero_si128();
+		for(int row = band * 3; row < (band * 3) + 3; row++) {
+			col_or = _mm_or_si128(col_or, rows.low[row]);
+			col_sum = _mm_add_epi16(col_sum, rows.low[row]);
+			last_or = _mm_or_si128(last_or, rows.high[row]);
+			last_sum = _mm_add_epi16(last_sum, rows.high[row]);
+			band_or[band] = _mm_or_si128(band_or[band], rows.thirds_or[row]);
+			band_sum[band] = _mm_add_epi16(band_sum[band], rows.thirds_sum[row]);
+		}
+	}
+}
+
+KERNEL_INLINE bool isValidReduced(const ReducedRows& rows) {
+	__m128i col_or, col_sum, last_or, last_sum, band_or[3], band_sum[3];
+	reduceColumnsAndSquares(rows, col_or, col_sum, last_or, last_sum, band_or, band_sum);
+	const __m128i LANE_0 = _mm_setr_epi16(-1, 0, 0, 0, 0, 0, 0, 0);
+	const __m128i SQUARE_LANES = _mm_setr_epi16(-1, 0, 0, -1, 0, 0, -1, 0);
+	//Any difference between an OR and a sum, or any bit above the ninth digit (from a
+	//byte greater than 9), marks the board as invalid
+	__m128i errors = _mm_or_si128(_mm_xor_si128(col_or, col_sum), _mm_xor_si128(last_or, last_sum));
+	errors = _mm_or_si128(errors, _mm_andnot_si128(_mm_set1_epi16(0x1FF), _mm_or_si128(col_or, last_or)));
+	for(int row = 0; row < 9; row++) {
+		errors = _mm_or_si128(errors, _mm_and_si128(_mm_xor_si128(rows.whole_or[row], rows.whole_sum[row]), LANE_0));
+	}
+	for(int band = 0; band < 3; band++) {
+		errors = _mm_or_si128(errors, _mm_and_si128(_mm_xor_si128(band_or[band], band_sum[band]), SQUARE_LANES));
+	}
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(errors, _mm_setzero_si128())) == 0xFFFF;
+}
+
+KERNEL_INLINE void getCandidatesReduced(const ReducedRows& rows, unsigned short* candidates) {
+	__m128i col_or, col_sum, last_or, last_sum, band_or[3], band_sum[3];
+	reduceColumnsAndSquares(rows, col_or, col_sum, last_or, last_sum, band_or, band_sum);
+	const __m128i ALL_DIGITS = _mm_set1_epi16(0x1FF);
+	const __m128i SQUARE_LANES = _mm_setr_epi16(-1, 0, 0, -1, 0, 0, -1, 0);
+	const __m128i ZERO = _mm_setzero_si128();
+	//Eight cells are stored per row, followed by the ninth
+	for(int row = 0; row < 9; row++) {
+		//Spread the row's OR over every lane, and each square's OR over its three lanes
+		__m128i row_used = _mm_shuffle_epi32(_mm_shufflelo_epi16(rows.whole_or[row], 0), 0);
+		__m128i squares = _mm_and_si128(band_or[row / 3], SQUARE_LANES);
+		__m128i square_used = _mm_or_si128(squares, _mm_or_si128(_mm_slli_si128(squares, 2),
+																	 _mm_slli_si128(squares, 4)));
+		__m128i allowed = _mm_andnot_si128(_mm_or_si128(row_used, _mm_or_si128(col_or, square_used)), ALL_DIGITS);
+		allowed = _mm_and_si128(allowed, _mm_cmpeq_epi16(rows.low[row], ZERO));
+		_mm_storeu_si128((__m128i*)(candidates + (row * 9)), allowed);
+		//The last cell takes column 8 and the band's third square
+		__m128i last_used = _mm_or_si128(row_used, _mm_or_si128(last_or, _mm_srli_si128(squares, 12)));
+		__m128i last = _mm_andnot_si128(last_used, ALL_DIGITS);
+		last = _mm_and_si128(last, _mm_cmpeq_epi16(rows.high[row], ZERO));
+		candidates[(row * 9) + 8] = (unsigned short)_mm_cvtsi128_si32(last);
+	}
+}
+
+//128-bit builds (SSSE3 is needed for the byte shuffle that turns digits into bits)
+__attribute__((target("ssse3")))
+static bool isValidSSSE3(const unsigned char* cells) {
+	ReducedRows rows;
+	reduceRows(cells, rows);
+	return isValidReduced(rows);
+}
+
+__attribute__((target("ssse3")))
+static void getCandidatesSSSE3(const unsigned char* cells, unsigned short* candidates) {
+	ReducedRows rows;
+	reduceRows(cells, rows);
+	getCandidatesReduced(rows, candidates);
+}
+
+//256-bit builds
+__attribute__((target("avx2")))
+static bool isValidAVX2(const unsigned char* cells) {
+	ReducedRows rows;
+	reduceRowPairs(cells, rows);
+	return isValidReduced(rows);
+}
+
+__attribute__((target("avx2")))
+static void getCandidatesAVX2(const unsigned char* cells, unsigned short* candidates) {
+	ReducedRows rows;
+	reduceRowPairs(cells, rows);
+	getCandidatesReduced(rows, candidates);
+}
+
+#endif
+
+/*** Public interface implementation ***/
+
+//Returns the fastest instruction set supported by this processor (detected once)
+BoardKernels::InstructionSet BoardKernels::getInstructionSet() {
+	static const InstructionSet best = isSupported(AVX2) ? AVX2 :
+									   isSupported(SSSE3) ? SSSE3 : SCALAR;
+	return best;
+}
+
+//Returns whether the kernels for an instruction set can run on this processor
+bool BoardKernels::isSupported(InstructionSet set) {
+#ifdef BOARD_KERNELS_VECTORIZED
+	switch(set) {
+		case AVX2:
+			return __builtin_cpu_supports("avx2");
+		case SSSE3:
+			return __builtin_cpu_supports("ssse3");
+		default:
+			return true;
+	}
+#else
+	return set == SCALAR;
+#endif
+}
+
+bool BoardKernels::isValid(const unsigned char* cells) {
+	return isValid(cells, getInstructionSet());
+}
+
+/**
+ * Returns whether no row, column, or square of a board repeats a digit, using the
+ * kernel for the given instruction set (which must be supported by the processor).
+ *
+ * @param 	cells 	The 81 bytes of the board, row by row
+ * @param 	set 	The instruction set whose kernel should be used
+ */
+bool BoardKernels::isValid(const unsigned char* cells, InstructionSet set) {
+#ifdef BOARD_KERNELS_VECTORIZED
+	switch(set) {
+		case AVX2:
+			return isValidAVX2(cells);
+		case SSSE3:
+			return isValidSSSE3(cells);
+		default:
+			break;
+	}
+#endif
+	return isValidScalar(cells);
+}
+
+void BoardKernels::getCandidates(const unsigned char* cells, unsigned short* candidates) {
+	getCandidates(cells, candidates, getInstructionSet());
+}
+
+/**
+ * Computes the candidates of every cell of a board, using the kernel for the given
+ * instruction set (which must be supported by the processor).
+ *
+ * @param 	cells 		The 81 bytes of the board, row by row
+ * @param 	candidates 	An array of 81 masks to receive the candidates
+ * @param 	set 		The instruction set whose kernel should be used
+ */
+void BoardKernels::getCandidates(const unsigned char* cells, unsigned short* candidates, InstructionSet set) {
+#ifdef BOARD_KERNELS_VECTORIZED
+	switch(set) {
+		case AVX2:
+			getCandidatesAVX2(cells, candidates);
+			return;
+		case SSSE3:
+			getCandidatesSSSE3(cells, candidates);
+			return;
+		default:
+			break;
+	}
+#endif
+	getCandidatesScalar(cells, candidates);
+}
@@ -0,0 +1,46 @@
+/**
+ * @file BoardKernels.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the BoardKernels class, a set of vectorized routines that work on a compact
+ * board of 81 bytes (0 for a missing value, otherwise the digit). Each routine checks
+ * all 27 units, or computes the candidates of all 81 cells, at once: each row's digits
+ * are turned into 16-bit digit bits with a byte shuffle, rows and squares are reduced
+ * horizontally with lane shifts, and columns and squares vertically across rows. A unit
+ * holds no duplicate digits exactly when the OR of its digit bits equals their sum.
+ *
+ * The kernels come in a 128-bit (SSSE3) build and a 256-bit (AVX2) build that reduces
+ * two rows per register; the best one the processor supports is selected at runtime. A
+ * plain scalar version is kept as a fallback for other processors and as a reference.
+ */
+
+#ifndef BOARD_KERNELS_H
+#define BOARD_KERNELS_H
+
+class BoardKernels {
+
+public:
+
+	enum InstructionSet {
+		SCALAR,
+		SSSE3,
+		AVX2
+	};
+
+	//Returns whether no row, column, or square of a board repeats a digit. Every byte
+	//must be 0 (missing) or a digit from 1 to 9.
+	static bool isValid(const unsigned char* cells);
+	static bool isValid(const unsigned char* cells, InstructionSet set);
+
+	//Writes the mask of digits that could be placed in each of a board's 81 cells (bit
+	//d - 1 for the digit d) into an array; filled cells receive an empty mask
+	static void getCandidates(const unsigned char* cells, unsigned short* candidates);
+	static void getCandidates(const unsigned char* cells, unsigned short* candidates, InstructionSet set);
+
+	static InstructionSet getInstructionSet();
+	static bool isSupported(InstructionSet set);
+
+};
+
+#endif
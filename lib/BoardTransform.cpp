@@ -0,0 +1,288 @@
+/**
+ * @file BoardTransform.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the BoardTransform structure and for canonicalization.
+ * For details, see 'BoardTransform.h'.
+ */
+
+//Protected includes
+#include <cstdint>
+#include <cstring>
+
+//Header include
+#include "BoardTransform.h"
+
+using namespace std;
+
+//Marks a digit that has not been given a label yet
+static const uint8_t UNLABELED = 0xFF;
+//The label of a missing value while searching, which sorts after every digit
+static const uint8_t BLANK = 10;
+
+//Digit labels handed out so far, in order of first appearance
+struct Labels {
+
+	uint8_t of[10];
+	uint8_t next;
+
+	Labels() {
+		this->of[0] = BLANK;
+		for(int d = 1; d <= 9; d++) {
+			this->of[d] = UNLABELED;
+		}
+		this->next = 1;
+	}
+
+	//Returns the label of a value, handing out the next label to a new digit
+	uint8_t get(uint8_t value) {
+		if(this->of[value] == UNLABELED) {
+			this->of[value] = this->next++;
+		}
+		return this->of[value];
+	}
+
+};
+
+/**
+ * A depth-first search over the transforms of one orientation of a puzzle. The first
+ * row of the image is chosen, then the column order (cell by cell), then the remaining
+ * rows, each step comparing what it has produced against the smallest image found so
+ * far and abandoning any branch that has already come out larger.
+ */
+struct CanonicalSearch {
+
+	//The puzzle, transposed or not
+	uint8_t source[81];
+	bool transpose;
+
+	//The smallest image found so far, and the transform producing it
+	uint8_t best[81];
+	bool found;
+	BoardTransform best_transform;
+
+	//The transform being built
+	uint8_t rows[9];
+	uint8_t cols[9];
+	uint8_t image[81];
+	bool row_used[9];
+	bool col_used[9];
+	bool band_used[3];
+	bool stack_used[3];
+
+	CanonicalSearch() {
+		this->found = false;
+	}
+
+	void start(const Board& puzzle, bool transpose) {
+		this->transpose = transpose;
+		for(int i = 0; i < 81; i++) {
+			this->source[i] = transpose ? puzzle.get(((i % 9) * 9) + (i / 9)) : puzzle.get(i);
+		}
+		memset(this->row_used, 0, sizeof(this->row_used));
+		memset(this->col_used, 0, sizeof(this->col_used));
+		memset(this->band_used, 0, sizeof(this->band_used));
+		memset(this->stack_used, 0, sizeof(this->stack_used));
+		for(int row = 0; row < 9; row++) {
+			Labels labels;
+			this->rows[0] = (uint8_t)row;
+			this->row_used[row] = true;
+			this->band_used[row / 3] = true;
+			this->searchColumns(0, labels, false);
+			this->row_used[row] = false;
+			this->band_used[row / 3] = false;
+		}
+	}
+
+	/**
+	 * Chooses the column placed at one position of the image, filling in that cell of
+	 * the first row. Returns true if the best image was replaced below this point.
+	 *
+	 * @param 	position 	The column of the image being filled
+	 * @param 	labels 		The digit labels handed out so far
+	 * @param 	less 		Whether the image built so far is already smaller than the best
+	 */
+	bool searchColumns(int position, const Labels& labels, bool less) {
+		if(position == 9) {
+			return this->searchRows(1, labels, less);
+		}
+		bool replaced = false;
+		int first = (position % 3 == 0) ? 0 : (this->cols[position - 1] / 3) * 3;
+		int last = (position % 3 == 0) ? 9 : first + 3;
+		for(int col = first; col < last; col++) {
+			if(this->col_used[col] || (position % 3 == 0 && this->stack_used[col / 3])) {
+				continue;
+			}
+			Labels next = labels;
+			uint8_t value = next.get(this->source[(this->rows[0] * 9) + col]);
+			bool child_less = less || !this->found;
+			if(!child_less) {
+				if(value > this->best[position]) {
+					continue;
+				}
+				child_less = value < this->best[position];
+			}
+			this->image[position] = value;
+			this->cols[position] = (uint8_t)col;
+			this->col_used[col] = true;
+			this->stack_used[col / 3] = true;
+			if(this->searchColumns(position + 1, next, child_less)) {
+				//The best image now shares this prefix
+				replaced = true;
+				less = false;
+			}
+			this->col_used[col] = false;
+			if(position % 3 == 0) {
+				this->stack_used[col / 3] = false;
+			}
+		}
+		return replaced;
+	}
+
+	/**
+	 * Chooses the source row of one row of the image (from an unused band at the start
+	 * of a band, otherwise from the band already begun). Returns true if the best image
+	 * was replaced below this point.
+	 *
+	 * @param 	depth 	The row of the image being filled
+	 * @param 	labels 	The digit labels handed out so far
+	 * @param 	less 	Whether the image built so far is already smaller than the best
+	 */
+	bool searchRows(int depth, const Labels& labels, bool less) {
+		if(depth == 9) {
+			return this->record(labels, less);
+		}
+		bool replaced = false;
+		int first = (depth % 3 == 0) ? 0 : (this->rows[depth - 1] / 3) * 3;
+		int last = (depth % 3 == 0) ? 9 : first + 3;
+		for(int row = first; row < last; row++) {
+			if(this->row_used[row] || (depth % 3 == 0 && this->band_used[row / 3])) {
+				continue;
+			}
+			Labels next = labels;
+			bool child_less = less || !this->found;
+			bool larger = false;
+			uint8_t* target = &this->image[depth * 9];
+			for(int k = 0; k < 9; k++) {
+				target[k] = next.get(this->source[(row * 9) + this->cols[k]]);
+				if(!child_less) {
+					uint8_t expected = this->best[(depth * 9) + k];
+					if(target[k] > expected) {
+						larger = true;
+						break;
+					}
+					child_less = target[k] < expected;
+				}
+			}
+			if(larger) {
+				continue;
+			}
+			this->rows[depth] = (uint8_t)row;
+			this->row_used[row] = true;
+			this->band_used[row / 3] = true;
+			if(this->searchRows(depth + 1, next, child_less)) {
+				replaced = true;
+				less = false;
+			}
+			this->row_used[row] = false;
+			if(depth % 3 == 0) {
+				this->band_used[row / 3] = false;
+			}
+		}
+		return replaced;
+	}
+
+	//Keeps a complete image if it is smaller than the best so far
+	bool record(const Labels& labels, bool less) {
+		if(this->found && !less) {
+			return false;
+		}
+		memcpy(this->best, this->image, 81);
+		this->found = true;
+		BoardTransform& transform = this->best_transform;
+		transform.transpose = this->transpose;
+		memcpy(transform.rows, this->rows, 9);
+		memcpy(transform.cols, this->cols, 9);
+		//Digits the puzzle doesn't use get the remaining labels, in order
+		Labels full = labels;
+		for(int d = 1; d <= 9; d++) {
+			transform.digits[d] = full.get((uint8_t)d);
+		}
+		transform.digits[0] = 0;
+		return true;
+	}
+
+};
+
+/*** Public interface implementation ***/
+
+//Public constructor. Starts out as the identity transform.
+BoardTransform::BoardTransform() {
+	this->transpose = false;
+	for(int i = 0; i < 9; i++) {
+		this->rows[i] = (uint8_t)i;
+		this->cols[i] = (uint8_t)i;
+	}
+	for(int d = 0; d <= 9; d++) {
+		this->digits[d] = (uint8_t)d;
+	}
+}
+
+/**
+ * Writes the image of a board under this transform.
+ *
+ * @param 	board 	The board to transform
+ * @param 	image 	Receives the transformed board
+ */
+void BoardTransform::apply(const Board& board, Board& image) const {
+	for(int i = 0; i < 9; i++) {
+		for(int j = 0; j < 9; j++) {
+			int source = this->transpose ? ((this->cols[j] * 9) + this->rows[i]) : ((this->rows[i] * 9) + this->cols[j]);
+			image.set((i * 9) + j, this->digits[board.get(source)]);
+		}
+	}
+}
+
+/**
+ * Writes the board whose image under this transform is the given board (undoing the
+ * transform).
+ *
+ * @param 	image 	A transformed board
+ * @param 	board 	Receives the original board
+ */
+void BoardTransform::invert(const Board& image, Board& board) const {
+	uint8_t inverse[10];
+	for(int d = 0; d <= 9; d++) {
+		inverse[this->digits[d]] = (uint8_t)d;
+	}
+	for(int i = 0; i < 9; i++) {
+		for(int j = 0; j < 9; j++) {
+			int source = this->transpose ? ((this->cols[j] * 9) + this->rows[i]) : ((this->rows[i] * 9) + this->cols[j]);
+			board.set(source, inverse[image.get((i * 9) + j)]);
+		}
+	}
+}
+
+/*** Static class method implementations ***/
+
+/**
+ * Finds the canonical form of a puzzle (the smallest board it can be transformed into)
+ * and a transform mapping the puzzle onto it. Branches that can't beat the smallest
+ * image found so far are cut off as soon as they fall behind it, so typical puzzles
+ * need only a small part of the 3,359,232 row and column arrangements; boards with
+ * very few clues leave many arrangements tied and take far longer.
+ *
+ * @param 	puzzle 		A board holding only digits and missing values
+ * @param 	canonical 	Receives the canonical form
+ * @param 	transform 	Receives a transform whose image of the puzzle is the canonical form
+ */
+void BoardTransform::canonicalize(const Board& puzzle, Board& canonical, BoardTransform& transform) {
+	CanonicalSearch search;
+	search.start(puzzle, false);
+	search.start(puzzle, true);
+	transform = search.best_transform;
+	for(int i = 0; i < 81; i++) {
+		canonical.set(i, (search.best[i] == BLANK) ? 0 : search.best[i]);
+	}
+}
@@ -0,0 +1,50 @@
+/**
+ * @file BoardTransform.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the BoardTransform structure, one of the symmetries of Sudoku: an optional
+ * transposition, a permutation of the rows (the bands, and the rows within each band),
+ * a permutation of the columns (the stacks, and the columns within each stack), and a
+ * relabeling of the digits. Any transform maps a valid grid to a valid grid, and a
+ * puzzle's solutions to the solutions of its image.
+ *
+ * Also describes canonicalization: every puzzle is mapped to the lexicographically
+ * smallest board it can be transformed into (reading cells row by row, a missing value
+ * after every digit), along with the transform that does so. Two puzzles have the same
+ * canonical form exactly when one is a transform of the other, so the canonical form
+ * can key a cache shared by every puzzle in an equivalence class.
+ */
+
+#ifndef BOARD_TRANSFORM_H
+#define BOARD_TRANSFORM_H
+
+//Protected includes (for member types)
+#include <cstdint>
+
+//Header includes (for argument types)
+#include "Board.h"
+
+using namespace std;
+
+struct BoardTransform {
+
+	//Whether the board is transposed before its rows and columns are permuted
+	bool transpose;
+	//Row i of the image is row rows[i] of the (transposed) board; likewise for columns
+	uint8_t rows[9];
+	uint8_t cols[9];
+	//The image of each digit; zero (a missing value) always maps to zero
+	uint8_t digits[10];
+
+	BoardTransform();
+
+	void apply(const Board& board, Board& image) const;
+	void invert(const Board& image, Board& board) const;
+
+	//Static helper function
+	static void canonicalize(const Board& puzzle, Board& canonical, BoardTransform& transform);
+
+};
+
+#endif
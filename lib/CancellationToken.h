@@ -0,0 +1,48 @@
+/**
+ * @file CancellationToken.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the CancellationToken class, a flag that one thread can trip to ask searches
+ * running on other threads to stop. Searches poll the token cooperatively; tripping it
+ * never interrupts a search in the middle of an update.
+ */
+
+#ifndef CANCELLATION_TOKEN_H
+#define CANCELLATION_TOKEN_H
+
+//Protected includes (for member types)
+#include <atomic>
+
+using namespace std;
+
+class CancellationToken {
+
+private:
+
+	atomic<bool> cancelled;
+
+	//Non-copyable
+	CancellationToken(const CancellationToken&);
+	CancellationToken& operator=(const CancellationToken&);
+
+public:
+
+	CancellationToken() : cancelled(false) {
+	}
+
+	void cancel() {
+		this->cancelled.store(true, memory_order_release);
+	}
+
+	void reset() {
+		this->cancelled.store(false, memory_order_release);
+	}
+
+	bool isCancelled() const {
+		return this->cancelled.load(memory_order_acquire);
+	}
+
+};
+
+#endif
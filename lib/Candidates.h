@@ -0,0 +1,223 @@
+/**
+ * @file Candidates.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the GridCandidates template, which tracks the digits already used in every
+ * row, column, and box of a grid built from boxes of BOX x BOX cells (see
+ * 'GridGeometry.h'), as one mask per unit. Bit (d - 1) of a mask is set when the digit d
+ * has been placed within that unit. Testing whether a digit may be placed in a cell is a
+ * single AND of three masks, and placing or removing a digit is O(1).
+ *
+ * Candidates, the form used throughout for 9x9 boards, is GridCandidates<3>; its masks
+ * hold nine bits, and its static helpers work on the cells and digits of a Board.
+ */
+
+#ifndef CANDIDATES_H
+#define CANDIDATES_H
+
+//Protected includes (for argument and return types)
+#include <vector>
+#include <cstdint>
+
+//Header includes (for argument and member types)
+#include "Board.h"
+#include "GridGeometry.h"
+
+using namespace std;
+
+template<int BOX>
+class GridCandidates {
+
+public:
+
+	typedef GridGeometry<BOX> Geometry;
+	typedef typename Geometry::Mask Mask;
+
+	static constexpr int SIDE = Geometry::SIDE;
+	static constexpr int CELLS = Geometry::CELLS;
+
+	//Mask with a bit set for each of the grid's digits
+	static constexpr Mask ALL_DIGITS = Geometry::ALL_DIGITS;
+
+private:
+
+	Mask row_masks[SIDE];
+	Mask col_masks[SIDE];
+	Mask square_masks[SIDE];
+
+public:
+
+	GridCandidates();
+
+	void clear();
+	bool load(const vector<int>& state);
+	bool load(const uint8_t* cells);
+	bool load(const Board& board);
+
+	Mask get(int index) const;
+	Mask getUnitUsed(int unit) const;
+	bool allows(int index, int digit) const;
+	void place(int index, int digit);
+	void remove(int index, int digit);
+
+	//Static helper functions for working with digit masks
+	static Mask digitToMask(int digit);
+	static int countDigits(Mask mask);
+	static int lowestDigit(Mask mask);
+	static int rowOf(int index);
+	static int colOf(int index);
+	static int squareOf(int index);
+
+};
+
+//The candidates of a 9x9 board
+typedef GridCandidates<3> Candidates;
+
+/*** Public interface implementation ***/
+
+//Public constructor. The masks start out empty (every digit is a candidate everywhere).
+template<int BOX>
+GridCandidates<BOX>::GridCandidates() {
+	this->clear();
+}
+
+//Marks every digit as unused in every row, column, and square
+template<int BOX>
+void GridCandidates<BOX>::clear() {
+	for(int i = 0; i < SIDE; i++) {
+		this->row_masks[i] = 0;
+		this->col_masks[i] = 0;
+		this->square_masks[i] = 0;
+	}
+}
+
+/**
+ * Rebuilds the masks from a game state in a single pass over the board. Returns false
+ * (leaving the masks partially filled) if the state places the same digit twice within
+ * any row, column, or square, or if it contains a value that is neither a digit nor -1.
+ *
+ * @param 	state 	A reference to a vector describing a possible game state
+ */
+template<int BOX>
+bool GridCandidates<BOX>::load(const vector<int>& state) {
+	this->clear();
+	for(int i = 0; i < state.size() && i < CELLS; i++) {
+		int value = state[i];
+		if(value == -1) {
+			continue;
+		}
+		if(value < 1 || value > SIDE || !this->allows(i, value)) {
+			return false;
+		}
+		this->place(i, value);
+	}
+	return true;
+}
+
+/**
+ * Rebuilds the masks from a game state held as one byte per cell, zero for an unsolved
+ * value (see above).
+ *
+ * @param 	cells 	The first of CELLS bytes describing a possible game state
+ */
+template<int BOX>
+bool GridCandidates<BOX>::load(const uint8_t* cells) {
+	this->clear();
+	for(int i = 0; i < CELLS; i++) {
+		int value = cells[i];
+		if(value == 0) {
+			continue;
+		}
+		if(value > SIDE || !this->allows(i, value)) {
+			return false;
+		}
+		this->place(i, value);
+	}
+	return true;
+}
+
+/**
+ * Rebuilds the masks from a board (see above). Returns false if the board places the
+ * same digit twice within any unit, or holds an invalid cell.
+ *
+ * @param 	board 	A reference to a board
+ */
+template<int BOX>
+bool GridCandidates<BOX>::load(const Board& board) {
+	static_assert(CELLS == 81, "a Board holds a 9x9 grid");
+	return this->load(board.data());
+}
+
+/*** Inline implementations (these sit on the solver's hot path) ***/
+
+//The units of a cell are looked up in the geometry's tables rather than computed
+template<int BOX>
+inline int GridCandidates<BOX>::rowOf(int index) {
+	return Geometry::TABLES.row_of[index];
+}
+
+template<int BOX>
+inline int GridCandidates<BOX>::colOf(int index) {
+	return Geometry::TABLES.col_of[index];
+}
+
+template<int BOX>
+inline int GridCandidates<BOX>::squareOf(int index) {
+	return Geometry::TABLES.box_of[index];
+}
+
+template<int BOX>
+inline typename GridCandidates<BOX>::Mask GridCandidates<BOX>::digitToMask(int digit) {
+	return (Mask)((Mask)1 << (digit - 1));
+}
+
+template<int BOX>
+inline int GridCandidates<BOX>::countDigits(Mask mask) {
+	return __builtin_popcount(mask);
+}
+
+//Returns the smallest digit contained in a non-empty mask
+template<int BOX>
+inline int GridCandidates<BOX>::lowestDigit(Mask mask) {
+	return __builtin_ctz(mask) + 1;
+}
+
+//Returns a mask of the digits that could still be placed at the given cell
+template<int BOX>
+inline typename GridCandidates<BOX>::Mask GridCandidates<BOX>::get(int index) const {
+	return ALL_DIGITS & ~(this->row_masks[rowOf(index)] |
+						  this->col_masks[colOf(index)] |
+						  this->square_masks[squareOf(index)]);
+}
+
+//Returns the mask of the digits already placed within a unit (rows, then columns, then
+//squares, as in the geometry's unit table)
+template<int BOX>
+inline typename GridCandidates<BOX>::Mask GridCandidates<BOX>::getUnitUsed(int unit) const {
+	return (unit < SIDE) ? this->row_masks[unit] :
+		   (unit < 2 * SIDE) ? this->col_masks[unit - SIDE] : this->square_masks[unit - (2 * SIDE)];
+}
+
+template<int BOX>
+inline bool GridCandidates<BOX>::allows(int index, int digit) const {
+	return (this->get(index) & digitToMask(digit)) != 0;
+}
+
+template<int BOX>
+inline void GridCandidates<BOX>::place(int index, int digit) {
+	Mask bit = digitToMask(digit);
+	this->row_masks[rowOf(index)] |= bit;
+	this->col_masks[colOf(index)] |= bit;
+	this->square_masks[squareOf(index)] |= bit;
+}
+
+template<int BOX>
+inline void GridCandidates<BOX>::remove(int index, int digit) {
+	Mask bit = (Mask)~digitToMask(digit);
+	this->row_masks[rowOf(index)] &= bit;
+	this->col_masks[colOf(index)] &= bit;
+	this->square_masks[squareOf(index)] &= bit;
+}
+
+#endif
@@ -0,0 +1,289 @@
+/**
+ * @file DancingLinks.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the public interface and private methods of the
+ * DancingLinks class. For details about this class, see 'DancingLinks.h'.
+ */
+
+//Protected includes
+#include <vector>
+#include <cstring>
+#include <cstddef>
+
+//Header includes
+#include "DancingLinks.h"
+#include "Candidates.h"
+
+using namespace std;
+
+/*** Public interface implementation ***/
+
+//Public constructor. Starts out with an empty board and a fully linked matrix.
+DancingLinks::DancingLinks() {
+	*this = getEmptyMatrix();
+}
+
+/**
+ * Copies a board into the working board, and prepares the matrix by selecting the
+ * candidate row of every digit that is already given. Returns false if the board
+ * already contains a conflict, in which case it cannot be solved.
+ *
+ * @param 	state 	A reference to a board
+ */
+bool DancingLinks::load(const Board& state) {
+	//Givens which conflict with one another would try to cover the same column twice
+	Candidates used;
+	if(!used.load(state)) {
+		return false;
+	}
+	//Start again from the fully linked matrix rather than rebuilding every link
+	const DancingLinks& empty = getEmptyMatrix();
+	memcpy(this->left, empty.left, sizeof(this->left));
+	memcpy(this->right, empty.right, sizeof(this->right));
+	memcpy(this->up, empty.up, sizeof(this->up));
+	memcpy(this->down, empty.down, sizeof(this->down));
+	memcpy(this->size, empty.size, sizeof(this->size));
+	for(int i = 0; i < 81; i++) {
+		this->board[i] = state.isEmpty(i) ? -1 : state.get(i);
+		if(this->board[i] != -1) {
+			this->selectRow(getFirstNodeOfRow(getRowByCandidate(i, this->board[i])));
+		}
+	}
+	return true;
+}
+
+/**
+ * Searches for a solution to the loaded board. Returns a boolean value indicating
+ * whether one was found; if so, the working board holds the solution.
+ */
+bool DancingLinks::solve() {
+	this->stats.reset();
+	this->solution_limit = 1;
+	this->solutions = 0;
+	this->callback = NULL;
+	this->startBudget();
+	this->search(0);
+	return this->solutions > 0;
+}
+
+/**
+ * Counts the solutions of the loaded board without storing any of them, stopping as
+ * soon as 'limit' solutions have been found. The working board holds the last solution
+ * found, if any.
+ *
+ * @param 	limit 		The number of solutions at which to stop (zero for no limit)
+ * @param 	callback 	If not NULL, receives each solution as it is found, and may stop
+ * 						the enumeration by returning false
+ */
+long DancingLinks::countSolutions(long limit, SolutionCallback* callback) {
+	this->stats.reset();
+	this->solution_limit = limit;
+	this->solutions = 0;
+	this->callback = callback;
+	this->startBudget();
+	this->search(0);
+	this->callback = NULL;
+	return this->solutions;
+}
+
+/**
+ * Copies the working board into the given board.
+ *
+ * @param 	state 	A reference to the board which will receive the working board
+ */
+void DancingLinks::getBoard(Board& state) const {
+	for(int i = 0; i < 81; i++) {
+		state.set(i, (this->board[i] == -1) ? 0 : (uint8_t)this->board[i]);
+	}
+}
+
+/*** Static class method implementations ***/
+
+/**
+ * Returns the matrix row describing the placement of a digit at the given cell.
+ *
+ * @param 	index 	The index of the cell
+ * @param 	digit 	The digit being placed
+ */
+int DancingLinks::getRowByCandidate(int index, int digit) {
+	return (index * 9) + (digit - 1);
+}
+
+/**
+ * Returns the index of the first of the four nodes belonging to a matrix row. The
+ * remaining nodes follow it directly, in constraint order (cell, row-digit,
+ * column-digit, square-digit).
+ *
+ * @param 	row 	The index of the matrix row
+ */
+int DancingLinks::getFirstNodeOfRow(int row) {
+	return COLUMNS + 1 + (row * 4);
+}
+
+/*** Private method implementations ***/
+
+//Private constructor used to build the shared, fully linked matrix
+DancingLinks::DancingLinks(bool build) {
+	this->solution_limit = 1;
+	this->solutions = 0;
+	this->callback = NULL;
+	if(build) {
+		this->buildEmptyMatrix();
+	}
+}
+
+//Returns the fully linked matrix (with an empty board), building it on first use
+const DancingLinks& DancingLinks::getEmptyMatrix() {
+	static const DancingLinks empty(true);
+	return empty;
+}
+
+//Links every column header, the root, and all 729 candidate rows
+void DancingLinks::buildEmptyMatrix() {
+	//Column headers form a circular list through the root
+	for(int c = 0; c <= ROOT; c++) {
+		this->left[c] = (c == 0) ? ROOT : c - 1;
+		this->right[c] = (c == ROOT) ? 0 : c + 1;
+		this->up[c] = c;
+		this->down[c] = c;
+		this->column[c] = c;
+		if(c < COLUMNS) {
+			this->size[c] = 0;
+		}
+	}
+	for(int index = 0; index < 81; index++) {
+		int row = Candidates::rowOf(index);
+		int col = Candidates::colOf(index);
+		int square = Candidates::squareOf(index);
+		for(int digit = 1; digit <= 9; digit++) {
+			int first = getFirstNodeOfRow(getRowByCandidate(index, digit));
+			int columns[4] = {
+				index,
+				81 + (row * 9) + (digit - 1),
+				162 + (col * 9) + (digit - 1),
+				243 + (square * 9) + (digit - 1)
+			};
+			for(int k = 0; k < 4; k++) {
+				int node = first + k;
+				int c = columns[k];
+				//Link the node into its row...
+				this->left[node] = first + ((k + 3) % 4);
+				this->right[node] = first + ((k + 1) % 4);
+				//...and append it to the bottom of its column
+				this->column[node] = c;
+				this->up[node] = this->up[c];
+				this->down[node] = c;
+				this->down[this->up[c]] = node;
+				this->up[c] = node;
+				this->size[c]++;
+			}
+		}
+	}
+	for(int i = 0; i < 81; i++) {
+		this->board[i] = -1;
+	}
+}
+
+//Removes a column from the header list, along with every row that intersects it
+void DancingLinks::cover(int c) {
+	this->right[this->left[c]] = this->right[c];
+	this->left[this->right[c]] = this->left[c];
+	for(int i = this->down[c]; i != c; i = this->down[i]) {
+		for(int j = this->right[i]; j != i; j = this->right[j]) {
+			this->down[this->up[j]] = this->down[j];
+			this->up[this->down[j]] = this->up[j];
+			this->size[this->column[j]]--;
+		}
+	}
+}
+
+//Reverses a call to cover(), relinking rows in the opposite order they were removed
+void DancingLinks::uncover(int c) {
+	for(int i = this->up[c]; i != c; i = this->up[i]) {
+		for(int j = this->left[i]; j != i; j = this->left[j]) {
+			this->size[this->column[j]]++;
+			this->down[this->up[j]] = j;
+			this->up[this->down[j]] = j;
+		}
+	}
+	this->right[this->left[c]] = c;
+	this->left[this->right[c]] = c;
+}
+
+//Covers every column of the row containing the given node
+void DancingLinks::selectRow(int node) {
+	this->cover(this->column[node]);
+	for(int j = this->right[node]; j != node; j = this->right[j]) {
+		this->cover(this->column[j]);
+	}
+}
+
+/**
+ * Writes the rows chosen by the search into the working board, counts the solution,
+ * and passes it to the callback, if there is one. Returns true if the search should
+ * stop here.
+ *
+ * @param 	depth 	The number of rows chosen by the search
+ */
+bool DancingLinks::recordSolution(int depth) {
+	for(int k = 0; k < depth; k++) {
+		int row = (this->chosen[k] - (COLUMNS + 1)) / 4;
+		this->board[row / 9] = (row % 9) + 1;
+	}
+	this->solutions++;
+	if(this->callback != NULL && !this->callback->onSolution(this->board)) {
+		return true;
+	}
+	return this->solution_limit > 0 && this->solutions >= this->solution_limit;
+}
+
+/**
+ * Algorithm X. Branches on the remaining column with the fewest rows, trying each of
+ * them in turn; a matrix with no columns left has been exactly covered. Returns true
+ * once the search should stop, with the last solution found in the working board.
+ *
+ * @param 	depth 	The number of rows chosen so far by the search
+ */
+bool DancingLinks::search(int depth) {
+	this->stats.nodes++;
+	SEARCH_STATS_ONLY(this->stats.recordDepth(depth));
+	if(this->isOverBudget()) {
+		return true;
+	}
+	if(this->right[ROOT] == ROOT) {
+		return this->recordSolution(depth);
+	}
+	//Choose the column with the fewest remaining rows
+	int best = this->right[ROOT];
+	for(int c = this->right[best]; c != ROOT; c = this->right[c]) {
+		if(this->size[c] < this->size[best]) {
+			best = c;
+			if(this->size[c] <= 1) {
+				break;
+			}
+		}
+	}
+	if(this->size[best] == 0) {
+		return false;
+	}
+	this->cover(best);
+	SEARCH_STATS_ONLY(this->stats.branches++);
+	for(int i = this->down[best]; i != best; i = this->down[i]) {
+		SEARCH_STATS_ONLY(this->stats.candidates_tried++);
+		this->chosen[depth] = i;
+		for(int j = this->right[i]; j != i; j = this->right[j]) {
+			this->cover(this->column[j]);
+		}
+		if(this->search(depth + 1)) {
+			return true;
+		}
+		SEARCH_STATS_ONLY(this->stats.backtracks++);
+		for(int j = this->left[i]; j != i; j = this->left[j]) {
+			this->uncover(this->column[j]);
+		}
+	}
+	this->uncover(best);
+	return false;
+}
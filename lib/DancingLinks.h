@@ -0,0 +1,85 @@
+/**
+ * @file DancingLinks.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the DancingLinks class, an implementation of Knuth's Algorithm X that models
+ * a Sudoku game as an exact-cover problem. The matrix has 324 columns (one for each cell,
+ * row-digit, column-digit, and square-digit constraint) and 729 rows (one for each digit
+ * that could be placed in each cell); every row covers exactly four columns. The search
+ * always branches on the column with the fewest remaining rows, which makes it much
+ * faster than a first-empty-cell search on sparse boards.
+ */
+
+#ifndef DANCING_LINKS_H
+#define DANCING_LINKS_H
+
+//Protected includes (for argument and return types)
+#include <vector>
+
+//Header include (for base type)
+#include "Solver.h"
+
+using namespace std;
+
+class DancingLinks : public Solver {
+
+public:
+
+	//Number of constraint columns, candidate rows, and nodes (column headers, followed
+	//by the root, followed by four nodes for each candidate row)
+	static const int COLUMNS = 324;
+	static const int ROWS = 729;
+	static const int ROOT = COLUMNS;
+	static const int NODES = COLUMNS + 1 + (ROWS * 4);
+
+private:
+
+	//Node links, stored as parallel arrays of node indices
+	short left[NODES];
+	short right[NODES];
+	short up[NODES];
+	short down[NODES];
+	short column[NODES];
+	//Number of rows remaining in each column
+	short size[COLUMNS];
+
+	//The working board; unsolved values are denoted by a -1
+	int board[81];
+	//The candidate row chosen at each level of the search
+	short chosen[81];
+
+	//Enumeration state: the search stops once solution_limit solutions have been found
+	//(zero meaning no limit) or the callback asks it to
+	long solution_limit;
+	long solutions;
+	SolutionCallback* callback;
+
+	void cover(int c);
+	void uncover(int c);
+	void selectRow(int node);
+	bool search(int depth);
+	bool recordSolution(int depth);
+
+	static const DancingLinks& getEmptyMatrix();
+	void buildEmptyMatrix();
+	DancingLinks(bool build);
+
+public:
+
+	DancingLinks();
+
+	using Solver::load;
+	using Solver::getBoard;
+	bool load(const Board& state);
+	bool solve();
+	void getBoard(Board& state) const;
+	long countSolutions(long limit, SolutionCallback* callback = NULL);
+
+	//Static helper functions for mapping between candidate rows, nodes, and cells
+	static int getRowByCandidate(int index, int digit);
+	static int getFirstNodeOfRow(int row);
+
+};
+
+#endif
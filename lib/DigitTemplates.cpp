@@ -0,0 +1,321 @@
+/**
+ * @file DigitTemplates.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the public interface and private methods of the
+ * DigitTemplates class. For details about this class, see 'DigitTemplates.h'.
+ */
+
+//Protected includes
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+//Header includes
+#include "DigitTemplates.h"
+#include "Candidates.h"
+
+using namespace std;
+
+//Words of a mask covering the whole grid
+static const uint64_t FULL_LOW = ~(uint64_t)0;
+static const uint64_t FULL_HIGH = ((uint64_t)1 << 17) - 1;
+
+//Labels of templates suiting any digit not yet given, and templates suiting no digit
+static const uint8_t ANY_DIGIT = 9;
+static const uint8_t NO_DIGIT = 10;
+
+/*** Public interface implementation ***/
+
+//Public constructor. Starts out with no board loaded, so no solution can be found until
+//load() is called; the shared template table is built on first use.
+DigitTemplates::DigitTemplates() {
+	this->solution_limit = 1;
+	this->solutions = 0;
+	this->callback = NULL;
+	this->ends[0] = 0;
+	for(int d = 0; d < 9; d++) {
+		this->starts[0][d] = 0;
+		this->counts[0][d] = 0;
+		this->chosen[d] = 0;
+	}
+	for(int i = 0; i < 81; i++) {
+		this->board[i] = -1;
+	}
+}
+
+/**
+ * Copies a board into the working board, and keeps for each digit only the templates
+ * compatible with the givens: those covering every cell given the digit and no other
+ * given cell. Returns false if the board already contains a conflict, in which case it
+ * cannot be solved.
+ *
+ * @param 	state 	A reference to a board
+ */
+bool DigitTemplates::load(const Board& state) {
+	Candidates used;
+	if(!used.load(state)) {
+		return false;
+	}
+	//The cells given each digit, and every given cell
+	Mask given[9];
+	Mask all = {0, 0};
+	for(int d = 0; d < 9; d++) {
+		given[d] = all;
+	}
+	for(int i = 0; i < 81; i++) {
+		this->board[i] = state.isEmpty(i) ? -1 : state.get(i);
+		if(this->board[i] != -1) {
+			given[this->board[i] - 1].add(i);
+			all.add(i);
+		}
+	}
+	//A template covering a given cell can only belong to that cell's digit, and then only
+	//if it covers exactly the cells given the digit; one covering no given cell suits
+	//every digit not yet given. One pass labels each template with the digit it suits.
+	const vector<Mask>& templates = getTemplates();
+	this->labels.resize(TEMPLATES);
+	int suited[NO_DIGIT + 1] = {0};
+	for(int t = 0; t < TEMPLATES; t++) {
+		Mask covered = {templates[t].low & all.low, templates[t].high & all.high};
+		uint8_t label = ANY_DIGIT;
+		if(covered.low != 0 || covered.high != 0) {
+			int cell = (covered.low != 0) ? __builtin_ctzll(covered.low) : 64 + __builtin_ctzll(covered.high);
+			int d = this->board[cell] - 1;
+			label = (covered.low == given[d].low && covered.high == given[d].high) ? d : NO_DIGIT;
+		}
+		this->labels[t] = label;
+		suited[label]++;
+	}
+	//Lay the digits' lists out one after another, and fill them in a second pass
+	size_t position = 0;
+	for(int d = 0; d < 9; d++) {
+		bool open = given[d].low == 0 && given[d].high == 0;
+		this->starts[0][d] = position;
+		this->counts[0][d] = open ? suited[ANY_DIGIT] : suited[d];
+		position += this->counts[0][d];
+	}
+	this->ends[0] = position;
+	if(this->lists.size() < position) {
+		this->lists.resize(position);
+	}
+	size_t next[9];
+	for(int d = 0; d < 9; d++) {
+		next[d] = this->starts[0][d];
+	}
+	for(int t = 0; t < TEMPLATES; t++) {
+		uint8_t label = this->labels[t];
+		if(label < 9) {
+			this->lists[next[label]++] = (uint16_t)t;
+		} else if(label == ANY_DIGIT) {
+			for(int d = 0; d < 9; d++) {
+				if(given[d].low == 0 && given[d].high == 0) {
+					this->lists[next[d]++] = (uint16_t)t;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+/**
+ * Searches for a solution to the loaded board. Returns a boolean value indicating
+ * whether one was found; if so, the working board holds the solution.
+ */
+bool DigitTemplates::solve() {
+	return this->countSolutions(1) > 0;
+}
+
+/**
+ * Counts the solutions of the loaded board without storing any of them, stopping as
+ * soon as 'limit' solutions have been found. The working board holds the last solution
+ * found, if any.
+ *
+ * @param 	limit 		The number of solutions at which to stop (zero for no limit)
+ * @param 	callback 	If not NULL, receives each solution as it is found, and may stop
+ * 						the enumeration by returning false
+ */
+long DigitTemplates::countSolutions(long limit, SolutionCallback* callback) {
+	this->stats.reset();
+	this->solution_limit = limit;
+	this->solutions = 0;
+	this->callback = callback;
+	this->startBudget();
+	Mask none = {0, 0};
+	this->search(0, Candidates::ALL_DIGITS, none);
+	this->callback = NULL;
+	return this->solutions;
+}
+
+/**
+ * Copies the working board into the given board.
+ *
+ * @param 	state 	A reference to the board which will receive the working board
+ */
+void DigitTemplates::getBoard(Board& state) const {
+	for(int i = 0; i < 81; i++) {
+		state.set(i, (this->board[i] == -1) ? 0 : (uint8_t)this->board[i]);
+	}
+}
+
+/*** Static class method implementations ***/
+
+//Returns the table of every template, building it on first use
+const vector<DigitTemplates::Mask>& DigitTemplates::getTemplates() {
+	static const vector<Mask> templates = buildTemplates();
+	return templates;
+}
+
+/*** Private method implementations ***/
+
+//Builds the table of every template, ordered by the column used in each row in turn
+vector<DigitTemplates::Mask> DigitTemplates::buildTemplates() {
+	vector<Mask> templates;
+	templates.reserve(TEMPLATES);
+	Mask none = {0, 0};
+	addTemplates(templates, 0, 0, 0, none);
+	return templates;
+}
+
+/**
+ * Adds every template extending a placement in the rows above the given one.
+ *
+ * @param 	templates 	The table receiving each complete template
+ * @param 	row 		The row in which to place the digit next
+ * @param 	cols 		The columns used by the rows above, as a 9-bit mask
+ * @param 	squares 	The squares used by the rows above, as a 9-bit mask
+ * @param 	cells 		The cells used by the rows above
+ */
+void DigitTemplates::addTemplates(vector<Mask>& templates, int row, unsigned short cols, unsigned short squares,
+								  Mask cells) {
+	if(row == 9) {
+		templates.push_back(cells);
+		return;
+	}
+	for(int col = 0; col < 9; col++) {
+		int index = (row * 9) + col;
+		int square = Candidates::squareOf(index);
+		if((cols & (1 << col)) != 0 || (squares & (1 << square)) != 0) {
+			continue;
+		}
+		Mask next = cells;
+		next.add(index);
+		addTemplates(templates, row + 1, cols | (1 << col), squares | (1 << square), next);
+	}
+}
+
+/**
+ * Chooses a template for the remaining digit with the fewest left, trying each of them
+ * in turn; once every digit has one, the board is solved. Returns true once the search
+ * should stop, with the last solution found in the working board.
+ *
+ * @param 	depth 		The number of digits placed so far by the search
+ * @param 	remaining 	The digits not yet placed, as a 9-bit mask
+ * @param 	occupied 	The cells covered by the templates chosen so far
+ */
+bool DigitTemplates::search(int depth, unsigned short remaining, const Mask& occupied) {
+	this->stats.nodes++;
+	SEARCH_STATS_ONLY(this->stats.recordDepth(depth));
+	if(this->isOverBudget()) {
+		return true;
+	}
+	if(remaining == 0) {
+		return this->recordSolution();
+	}
+	//Choose the digit with the fewest templates left
+	int best = -1;
+	for(int d = 0; d < 9; d++) {
+		if((remaining & (1 << d)) != 0 && (best == -1 || this->counts[depth][d] < this->counts[depth][best])) {
+			best = d;
+		}
+	}
+	const vector<Mask>& templates = getTemplates();
+	unsigned short rest = remaining & ~(1 << best);
+	SEARCH_STATS_ONLY(this->stats.branches++);
+	for(int k = 0; k < this->counts[depth][best]; k++) {
+		uint16_t t = this->lists[this->starts[depth][best] + k];
+		const Mask& cells = templates[t];
+		SEARCH_STATS_ONLY(this->stats.candidates_tried++);
+		Mask placed = {occupied.low | cells.low, occupied.high | cells.high};
+		if(this->filter(depth, rest, cells, placed)) {
+			this->chosen[best] = t;
+			if(this->search(depth + 1, rest, placed)) {
+				return true;
+			}
+		}
+		SEARCH_STATS_ONLY(this->stats.backtracks++);
+	}
+	return false;
+}
+
+/**
+ * Builds the next level's template lists, keeping each remaining digit's templates
+ * that are disjoint from the one just chosen. Returns false if this leaves some digit
+ * without a template, or some empty cell covered by no digit's templates, in which case
+ * the choice leads to no solution.
+ *
+ * @param 	depth 			The level of the lists being filtered
+ * @param 	remaining 		The digits still to be placed after the choice
+ * @param 	chosen_cells 	The cells of the template just chosen
+ * @param 	occupied 		The cells covered by every template chosen, this one included
+ */
+bool DigitTemplates::filter(int depth, unsigned short remaining, const Mask& chosen_cells, const Mask& occupied) {
+	const vector<Mask>& templates = getTemplates();
+	size_t position = this->ends[depth];
+	size_t needed = position;
+	for(int d = 0; d < 9; d++) {
+		if((remaining & (1 << d)) != 0) {
+			needed += this->counts[depth][d];
+		}
+	}
+	if(this->lists.size() < needed) {
+		this->lists.resize(needed);
+	}
+	uint16_t* list = this->lists.data();
+	Mask covered = occupied;
+	for(int d = 0; d < 9; d++) {
+		if((remaining & (1 << d)) == 0) {
+			continue;
+		}
+		this->starts[depth + 1][d] = position;
+		const uint16_t* open = list + this->starts[depth][d];
+		int count = this->counts[depth][d];
+		//Every template is written, but only those kept move the position on
+		for(int k = 0; k < count; k++) {
+			const Mask& cells = templates[open[k]];
+			uint64_t keep = !cells.intersects(chosen_cells);
+			list[position] = open[k];
+			position += keep;
+			covered.low |= cells.low & -keep;
+			covered.high |= cells.high & -keep;
+		}
+		this->counts[depth + 1][d] = position - this->starts[depth + 1][d];
+		if(this->counts[depth + 1][d] == 0) {
+			return false;
+		}
+	}
+	this->ends[depth + 1] = position;
+	return covered.low == FULL_LOW && covered.high == FULL_HIGH;
+}
+
+/**
+ * Writes the chosen templates into the working board, counts the solution, and passes
+ * it to the callback, if there is one. Returns true if the search should stop here.
+ */
+bool DigitTemplates::recordSolution() {
+	const vector<Mask>& templates = getTemplates();
+	for(int d = 0; d < 9; d++) {
+		const Mask& cells = templates[this->chosen[d]];
+		for(int i = 0; i < 81; i++) {
+			if(cells.contains(i)) {
+				this->board[i] = d + 1;
+			}
+		}
+	}
+	this->solutions++;
+	if(this->callback != NULL && !this->callback->onSolution(this->board)) {
+		return true;
+	}
+	return this->solution_limit > 0 && this->solutions >= this->solution_limit;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file DigitTemplates.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the DigitTemplates class, an exact engine that solves a board one digit at
+ * a time rather than one cell at a time. A template is one valid placement of a single
+ * digit across the grid: nine cells, one in every row, column, and square. There are
+ * 46,656 of them, precomputed once as 81-bit masks and shared by every instance.
+ *
+ * Loading a board keeps, for each digit, only the templates covering every cell given
+ * that digit and no cell given another. The search then picks a template for the digit
+ * with the fewest left, and keeps only the other digits' templates disjoint from it; a
+ * solution is nine pairwise disjoint templates. Each test is an AND of two 64-bit words,
+ * so the search runs wide and nearly branch-free, and since every remaining digit is
+ * filtered at each level, it is quickest on boards with many solutions to enumerate.
+ */
+
+#ifndef DIGIT_TEMPLATES_H
+#define DIGIT_TEMPLATES_H
+
+//Protected includes (for member types)
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+//Header include (for base type)
+#include "Solver.h"
+
+using namespace std;
+
+class DigitTemplates : public Solver {
+
+public:
+
+	//Number of valid placements of a single digit
+	static const int TEMPLATES = 46656;
+
+	//A set of cells: cells 0 to 63 in the low word, and 64 to 80 in the high word
+	struct Mask {
+
+		uint64_t low;
+		uint64_t high;
+
+		bool contains(int cell) const {
+			return (cell < 64) ? ((this->low >> cell) & 1) : ((this->high >> (cell - 64)) & 1);
+		}
+
+		void add(int cell) {
+			if(cell < 64) {
+				this->low |= (uint64_t)1 << cell;
+			} else {
+				this->high |= (uint64_t)1 << (cell - 64);
+			}
+		}
+
+		bool intersects(const Mask& other) const {
+			return ((this->low & other.low) | (this->high & other.high)) != 0;
+		}
+
+	};
+
+private:
+
+	//The templates still open to each digit at every level of the search, stored one
+	//level after another in a single buffer (reused from one search to the next). At
+	//level k, digit d's list starts at starts[k][d - 1] and holds counts[k][d - 1]
+	//template indices; the level ends at ends[k].
+	vector<uint16_t> lists;
+	size_t starts[10][9];
+	int counts[10][9];
+	size_t ends[10];
+	//The template chosen for each digit placed by the search
+	uint16_t chosen[9];
+	//The digit each template suits, as labelled by load()
+	vector<uint8_t> labels;
+
+	//The working board; unsolved values are denoted by a -1
+	int board[81];
+
+	//Enumeration state: the search stops once solution_limit solutions have been found
+	//(zero meaning no limit) or the callback asks it to
+	long solution_limit;
+	long solutions;
+	SolutionCallback* callback;
+
+	bool search(int depth, unsigned short remaining, const Mask& occupied);
+	bool filter(int depth, unsigned short remaining, const Mask& chosen_cells, const Mask& occupied);
+	bool recordSolution();
+
+	static vector<Mask> buildTemplates();
+	static void addTemplates(vector<Mask>& templates, int row, unsigned short cols, unsigned short squares,
+							 Mask cells);
+
+public:
+
+	DigitTemplates();
+
+	using Solver::load;
+	using Solver::getBoard;
+	bool load(const Board& state);
+	bool solve();
+	void getBoard(Board& state) const;
+	long countSolutions(long limit, SolutionCallback* callback = NULL);
+
+	//Static helper function returning the shared table of every template
+	static const vector<Mask>& getTemplates();
+
+};
+
+#endif
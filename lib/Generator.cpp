@@ -0,0 +1,342 @@
+/**
+ * @file Generator.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the public interface and private methods of the
+ * Generator class. For details about this class, see 'Generator.h'.
+ */
+
+//Protected includes
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+
+//Header includes
+#include "Generator.h"
+#include "ThreadPool.h"
+
+using namespace std;
+
+//Appends a puzzle to an output buffer in the one-line format, counting it in a summary
+static void appendPuzzle(const Board& puzzle, int target, string& output, GeneratorSummary& summary) {
+	int clues = 0;
+	for(int i = 0; i < 81; i++) {
+		if(puzzle.isEmpty(i)) {
+			output += '.';
+		} else {
+			output += (char)('0' + puzzle.get(i));
+			clues++;
+		}
+	}
+	output += '\n';
+	summary.puzzles++;
+	summary.clues += clues;
+	summary.above_target += (target > 0 && clues > target) ? 1 : 0;
+}
+
+/*** Public interface implementation ***/
+
+//Seeds the stream through splitmix64 (a zero state would leave xorshift stuck at zero)
+Generator::Random::Random(uint64_t seed) {
+	uint64_t z = seed + 0x9E3779B97F4A7C15ull;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	z ^= z >> 31;
+	this->state = (z == 0) ? 0x9E3779B97F4A7C15ull : z;
+}
+
+/**
+ * Public constructor. Starts out removing every clue it can, with no symmetry.
+ *
+ * @param 	seed 		The seed from which every puzzle's random stream is derived
+ * @param 	threads 	The number of worker threads (zero for one per hardware thread)
+ */
+Generator::Generator(uint64_t seed, int threads) {
+	this->clues = 0;
+	this->symmetry = NONE;
+	this->seed = seed;
+	this->setThreads(threads);
+	//Completing a grid and checking uniqueness both want the fastest backtracking search.
+	//The boards checked are nearly complete, and the singles rules settle them; looking
+	//for locked candidates as well costs more than it saves.
+	this->engine.setCellOrder(Engine::MINIMUM_REMAINING_VALUES);
+	this->engine.setPropagation(true);
+	this->engine.setLockedCandidates(false);
+}
+
+//Public getter for the clues member
+int Generator::getClues() const {
+	return this->clues;
+}
+
+//Public setter for the clues member; zero removes every clue that can be removed
+void Generator::setClues(int clues) {
+	this->clues = (clues < 0) ? 0 : (clues > 81) ? 81 : clues;
+}
+
+//Public getter for the symmetry member
+Generator::Symmetry Generator::getSymmetry() const {
+	return this->symmetry;
+}
+
+//Public setter for the symmetry member
+void Generator::setSymmetry(Symmetry symmetry) {
+	this->symmetry = symmetry;
+}
+
+//Public getter for the seed member
+uint64_t Generator::getSeed() const {
+	return this->seed;
+}
+
+//Public setter for the seed member
+void Generator::setSeed(uint64_t seed) {
+	this->seed = seed;
+}
+
+//Public getter for the threads member
+int Generator::getThreads() const {
+	return this->threads;
+}
+
+//Public setter for the threads member; zero selects one thread per hardware thread
+void Generator::setThreads(int threads) {
+	this->threads = (threads > 0) ? threads : ThreadPool::getDefaultSize();
+}
+
+/**
+ * Generates the puzzle at a given position of a run. The same seed, options, and
+ * position always give the same puzzle.
+ *
+ * @param 	index 	The position of the puzzle within a run
+ * @param 	puzzle 	Receives the puzzle
+ */
+void Generator::generate(long index, Board& puzzle) {
+	this->generateWith(index, puzzle, this->engine);
+}
+
+/**
+ * Generates a run of puzzles, writing them to an output stream in the one-line format
+ * ('.' for a missing value), in order. Returns totals for the run, including its wall
+ * time. With several threads, puzzles are generated in chunks on a ThreadPool, a few
+ * chunks per worker at a time, and written out once every chunk of a round is done.
+ *
+ * @param 	count 	The number of puzzles to generate
+ * @param 	output 	The stream which will receive one puzzle per line
+ */
+GeneratorSummary Generator::run(long count, ostream& output) {
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	GeneratorSummary summary;
+	Board puzzle;
+	if(this->threads <= 1) {
+		string buffer;
+		for(long i = 0; i < count; i++) {
+			this->generateWith(i, puzzle, this->engine);
+			appendPuzzle(puzzle, this->clues, buffer, summary);
+			if((i + 1) % CHUNK_SIZE == 0) {
+				output.write(buffer.data(), buffer.size());
+				buffer.clear();
+			}
+		}
+		output.write(buffer.data(), buffer.size());
+	} else {
+		ThreadPool pool(this->threads);
+		vector<Engine> engines(pool.size(), this->engine);
+		const int round_size = pool.size() * 4;
+		vector<string> buffers(round_size);
+		vector<GeneratorSummary> totals(round_size);
+		for(long first = 0; first < count; first += (long)round_size * CHUNK_SIZE) {
+			int chunks = 0;
+			for(; chunks < round_size && first + ((long)chunks * CHUNK_SIZE) < count; chunks++) {
+				long from = first + ((long)chunks * CHUNK_SIZE);
+				long to = (from + CHUNK_SIZE < count) ? from + CHUNK_SIZE : count;
+				string* buffer = &buffers[chunks];
+				GeneratorSummary* total = &totals[chunks];
+				buffer->clear();
+				*total = GeneratorSummary();
+				pool.submit([this, &engines, buffer, total, from, to](int worker) {
+					Board generated;
+					for(long i = from; i < to; i++) {
+						this->generateWith(i, generated, engines[worker]);
+						appendPuzzle(generated, this->clues, *buffer, *total);
+					}
+				});
+			}
+			pool.wait();
+			for(int c = 0; c < chunks; c++) {
+				output.write(buffers[c].data(), buffers[c].size());
+				summary.add(totals[c]);
+			}
+		}
+	}
+	output.flush();
+	summary.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	return summary;
+}
+
+/*** Static class method implementations ***/
+
+/**
+ * Fills a board with a random complete grid. The boxes on the diagonal share no unit,
+ * so each gets a random permutation of the digits; the engine completes the rest, and
+ * the bands, stacks, and the rows and columns within them are then shuffled (and the
+ * grid transposed half of the time), none of which can break a valid grid.
+ *
+ * @param 	random 	The random stream to draw from
+ * @param 	engine 	The engine used to complete the grid
+ * @param 	grid 	Receives the grid
+ */
+void Generator::generateGrid(Random& random, Engine& engine, Board& grid) {
+	Board seeded;
+	int digits[9] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+	for(int square = 0; square < 9; square += 4) {
+		random.shuffle(digits, 9);
+		for(int k = 0; k < 9; k++) {
+			seeded.set(Board::TABLES.units[18 + square][k], (uint8_t)digits[k]);
+		}
+	}
+	engine.load(seeded.data());
+	engine.solve();
+	uint8_t cells[81];
+	engine.getBoard(cells);
+	//Row and column maps: a shuffled band (or stack) order, then a shuffled order within each
+	int maps[2][9];
+	for(int m = 0; m < 2; m++) {
+		int bands[3] = {0, 1, 2};
+		random.shuffle(bands, 3);
+		for(int b = 0; b < 3; b++) {
+			int lines[3] = {0, 1, 2};
+			random.shuffle(lines, 3);
+			for(int k = 0; k < 3; k++) {
+				maps[m][(b * 3) + k] = (bands[b] * 3) + lines[k];
+			}
+		}
+	}
+	bool transpose = random.below(2) == 1;
+	for(int row = 0; row < 9; row++) {
+		for(int col = 0; col < 9; col++) {
+			int source = (maps[0][row] * 9) + maps[1][col];
+			grid.set(transpose ? ((col * 9) + row) : ((row * 9) + col), cells[source]);
+		}
+	}
+}
+
+/**
+ * Returns the cell a given cell is paired with under a symmetry (the cell itself if it
+ * has no partner, as on the axis of a reflection).
+ *
+ * @param 	index 		The index of a cell
+ * @param 	symmetry 	The symmetry
+ */
+int Generator::getImage(int index, Symmetry symmetry) {
+	int row = index / 9;
+	int col = index % 9;
+	switch(symmetry) {
+		case ROTATIONAL:
+			return 80 - index;
+		case MIRROR:
+			return (row * 9) + (8 - col);
+		case DIAGONAL:
+			return (col * 9) + row;
+		default:
+			return index;
+	}
+}
+
+/**
+ * Reads a symmetry from its name ('none', 'rotational', 'mirror', or 'diagonal').
+ * Returns false if the name is not recognized.
+ *
+ * @param 	name 		The name of a symmetry
+ * @param 	symmetry 	Receives the symmetry
+ */
+bool Generator::parseSymmetry(const string& name, Symmetry& symmetry) {
+	if(name == "none") {
+		symmetry = NONE;
+	} else if(name == "rotational") {
+		symmetry = ROTATIONAL;
+	} else if(name == "mirror") {
+		symmetry = MIRROR;
+	} else if(name == "diagonal") {
+		symmetry = DIAGONAL;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Returns a boolean value indicating whether the digits among a cell's peers leave
+ * only one digit possible there (as for a naked single).
+ *
+ * @param 	puzzle 	A board
+ * @param 	index 	The index of a cell
+ */
+bool Generator::isForced(const Board& puzzle, int index) {
+	unsigned int used = 0;
+	for(int k = 0; k < 20; k++) {
+		used |= 1u << puzzle.get(Board::TABLES.peers[index][k]);
+	}
+	//Bit zero stands for the missing value; bits one to nine for the digits
+	unsigned int allowed = ~used & 0x3FEu;
+	return (allowed & (allowed - 1)) == 0;
+}
+
+//Returns the number of cells of a board holding a digit
+int Generator::countClues(const Board& board) {
+	int clues = 0;
+	for(int i = 0; i < 81; i++) {
+		clues += board.isEmpty(i) ? 0 : 1;
+	}
+	return clues;
+}
+
+/*** Private method implementations ***/
+
+/**
+ * Generates the puzzle at a given position of a run with the given engine: a random
+ * complete grid, from which clues (or symmetric pairs of clues) are removed in random
+ * order for as long as the puzzle keeps a single solution and has more clues than the
+ * target.
+ *
+ * @param 	index 	The position of the puzzle within a run
+ * @param 	puzzle 	Receives the puzzle
+ * @param 	engine 	The engine used to complete the grid and count solutions
+ */
+void Generator::generateWith(long index, Board& puzzle, Engine& engine) const {
+	Random random(this->seed ^ ((uint64_t)index * 0xD1B54A32D192ED03ull));
+	generateGrid(random, engine, puzzle);
+	int order[81];
+	for(int i = 0; i < 81; i++) {
+		order[i] = i;
+	}
+	random.shuffle(order, 81);
+	int remaining = 81;
+	for(int i = 0; i < 81 && remaining > this->clues; i++) {
+		int cell = order[i];
+		int image = getImage(cell, this->symmetry);
+		int removed = (image == cell) ? 1 : 2;
+		//A cell already removed as another's image, or a pair that would overshoot the target
+		if(puzzle.isEmpty(cell) || remaining - removed < this->clues) {
+			continue;
+		}
+		uint8_t digit = puzzle.get(cell);
+		uint8_t image_digit = puzzle.get(image);
+		puzzle.clear(cell);
+		puzzle.clear(image);
+		//A removed clue that its peers still force can't open up a second solution
+		bool unique = isForced(puzzle, cell) && isForced(puzzle, image);
+		if(!unique) {
+			engine.load(puzzle.data());
+			unique = engine.countSolutions(2) == 1;
+		}
+		if(unique) {
+			remaining -= removed;
+		} else {
+			puzzle.set(cell, digit);
+			puzzle.set(image, image_digit);
+		}
+	}
+}
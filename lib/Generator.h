@@ -0,0 +1,162 @@
+/**
+ * @file Generator.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the Generator class, which produces puzzles with exactly one solution.
+ * Each puzzle starts from a random complete grid: the three boxes on the diagonal are
+ * independent of one another, so they are filled with random permutations of the
+ * digits and the rest of the grid is completed by the solver, after which the bands,
+ * stacks, rows, and columns are shuffled. Clues are then removed in random order,
+ * optionally in symmetric pairs, and after every removal the puzzle is checked by
+ * counting its solutions up to two; a removal that allows a second solution is undone.
+ * Removal stops at a target number of clues, or once no clue can be removed.
+ *
+ * Every puzzle draws from its own random stream, derived from the generator's seed and
+ * the puzzle's position in the run. The puzzles of a run therefore depend only on the
+ * seed, not on the number of threads or on which thread generated which puzzle, and a
+ * run can be reproduced (or any single puzzle regenerated) from its seed.
+ */
+
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+//Protected includes (for argument, return, and member types)
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+//Header includes (for member types)
+#include "Board.h"
+#include "Backtracker.h"
+
+using namespace std;
+
+//Totals describing a single call to Generator::run
+struct GeneratorSummary {
+
+	long puzzles;
+	//Puzzles whose clues could not all be removed down to the target
+	long above_target;
+	long clues;
+	//Wall-clock time spent generating and writing, in seconds
+	double seconds;
+
+	GeneratorSummary() {
+		this->puzzles = 0;
+		this->above_target = 0;
+		this->clues = 0;
+		this->seconds = 0;
+	}
+
+	void add(const GeneratorSummary& other) {
+		this->puzzles += other.puzzles;
+		this->above_target += other.above_target;
+		this->clues += other.clues;
+	}
+
+	double getPuzzlesPerSecond() const {
+		return (this->seconds > 0) ? (this->puzzles / this->seconds) : 0;
+	}
+
+	double getMeanClues() const {
+		return (this->puzzles > 0) ? ((double)this->clues / this->puzzles) : 0;
+	}
+
+};
+
+class Generator {
+
+public:
+
+	//The engine that completes grids and counts solutions
+	typedef Backtracker Engine;
+
+	//Patterns the removed clues can follow; a clue and its image are removed together
+	enum Symmetry {
+		NONE,
+		//Half-turn rotation about the center
+		ROTATIONAL,
+		//Reflection across the middle column
+		MIRROR,
+		//Reflection across the main diagonal
+		DIAGONAL
+	};
+
+	//A small, fast random stream (xorshift64*), seeded through splitmix64 so that
+	//nearby seeds give unrelated streams
+	class Random {
+	private:
+		uint64_t state;
+	public:
+		Random(uint64_t seed);
+		uint64_t next();
+		int below(int bound);
+		template<typename T> void shuffle(T* values, int count);
+	};
+
+private:
+
+	//The number of clues at which removal stops; zero to remove every clue possible
+	int clues;
+	Symmetry symmetry;
+	uint64_t seed;
+	int threads;
+	//The engine used by generate(); each worker of a parallel run has its own
+	Engine engine;
+
+	void generateWith(long index, Board& puzzle, Engine& engine) const;
+
+public:
+
+	//Number of puzzles handed to a worker at a time
+	static const int CHUNK_SIZE = 64;
+
+	Generator(uint64_t seed = 0, int threads = 1);
+
+	int getClues() const;
+	void setClues(int clues);
+	Symmetry getSymmetry() const;
+	void setSymmetry(Symmetry symmetry);
+	uint64_t getSeed() const;
+	void setSeed(uint64_t seed);
+	int getThreads() const;
+	void setThreads(int threads);
+
+	void generate(long index, Board& puzzle);
+	GeneratorSummary run(long count, ostream& output);
+
+	//Static helper functions
+	static void generateGrid(Random& random, Engine& engine, Board& grid);
+	static bool isForced(const Board& puzzle, int index);
+	static int getImage(int index, Symmetry symmetry);
+	static bool parseSymmetry(const string& name, Symmetry& symmetry);
+	static int countClues(const Board& board);
+
+};
+
+//Advances the stream, returning its next value
+inline uint64_t Generator::Random::next() {
+	this->state ^= this->state >> 12;
+	this->state ^= this->state << 25;
+	this->state ^= this->state >> 27;
+	return this->state * 0x2545F4914F6CDD1Dull;
+}
+
+//Returns a number from 0 up to (not including) the bound, by multiplying out the high bits
+inline int Generator::Random::below(int bound) {
+	return (int)(((this->next() >> 32) * (uint64_t)bound) >> 32);
+}
+
+//Shuffles an array in place (Fisher-Yates)
+template<typename T>
+void Generator::Random::shuffle(T* values, int count) {
+	for(int i = count - 1; i > 0; i--) {
+		int k = this->below(i + 1);
+		T value = values[i];
+		values[i] = values[k];
+		values[k] = value;
+	}
+}
+
+#endif
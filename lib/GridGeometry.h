@@ -0,0 +1,92 @@
+/**
+ * @file GridGeometry.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the GridGeometry template, the shape of a grid built from square boxes of
+ * BOX x BOX cells: its side length (BOX * BOX, which is also the number of digits),
+ * the unsigned type wide enough to hold a mask of every digit, and tables of the row,
+ * column, and box of every cell, the cells of every unit, and the peers of every cell.
+ * The tables of a 9x9 grid are also those of a Board (see 'Board.h'), and hold each cell
+ * in a byte. Everything is a compile-time constant, so code templated on a geometry gets fixed
+ * loop bounds and mask widths for each grid size.
+ */
+
+#ifndef GRID_GEOMETRY_H
+#define GRID_GEOMETRY_H
+
+//Protected includes (for member types)
+#include <cstdint>
+#include <type_traits>
+
+using namespace std;
+
+template<int BOX>
+struct GridGeometry {
+
+	static_assert(BOX >= 2 && BOX <= 5, "grids are supported from 4x4 to 25x25");
+
+	static constexpr int BOX_SIZE = BOX;
+	//Side length of the grid, and the number of digits
+	static constexpr int SIDE = BOX * BOX;
+	static constexpr int CELLS = SIDE * SIDE;
+	//Rows, then columns, then boxes
+	static constexpr int UNITS = 3 * SIDE;
+	//Cells sharing a unit with any given cell: the rest of its row and column, plus the
+	//rest of its box outside that row and column
+	static constexpr int PEERS = (2 * (SIDE - 1)) + ((BOX - 1) * (BOX - 1));
+
+	//Bit (d - 1) of a mask stands for the digit d
+	typedef typename conditional<(SIDE <= 16), uint16_t, uint32_t>::type Mask;
+	static constexpr Mask ALL_DIGITS = (Mask)((1ul << SIDE) - 1);
+
+	//The unsigned type the tables hold a cell index in
+	typedef typename conditional<(CELLS <= 256), uint8_t, uint16_t>::type Cell;
+	//Words in a set of cells held as one bit per cell (bit i % 64 of word i / 64)
+	static constexpr int WORDS = (CELLS + 63) / 64;
+
+	struct Tables {
+
+		Cell row_of[CELLS];
+		Cell col_of[CELLS];
+		Cell box_of[CELLS];
+		Cell units[UNITS][SIDE];
+		Cell peers[CELLS][PEERS];
+		//The peers of each cell again, as a set of cells
+		uint64_t peer_bits[CELLS][WORDS];
+
+		constexpr Tables() : row_of(), col_of(), box_of(), units(), peers(), peer_bits() {
+			for(int index = 0; index < CELLS; index++) {
+				this->row_of[index] = (Cell)(index / SIDE);
+				this->col_of[index] = (Cell)(index % SIDE);
+				this->box_of[index] = (Cell)(((index / (SIDE * BOX)) * BOX) + ((index % SIDE) / BOX));
+			}
+			for(int i = 0; i < SIDE; i++) {
+				for(int k = 0; k < SIDE; k++) {
+					this->units[i][k] = (Cell)((i * SIDE) + k);
+					this->units[SIDE + i][k] = (Cell)((k * SIDE) + i);
+					this->units[(2 * SIDE) + i][k] = (Cell)(((((i / BOX) * BOX) + (k / BOX)) * SIDE) +
+															((i % BOX) * BOX) + (k % BOX));
+				}
+			}
+			for(int index = 0; index < CELLS; index++) {
+				int count = 0;
+				for(int other = 0; other < CELLS; other++) {
+					if(other != index &&
+					   (this->row_of[other] == this->row_of[index] ||
+						this->col_of[other] == this->col_of[index] ||
+						this->box_of[other] == this->box_of[index])) {
+						this->peers[index][count++] = (Cell)other;
+						this->peer_bits[index][other / 64] |= (uint64_t)1 << (other % 64);
+					}
+				}
+			}
+		}
+
+	};
+
+	static constexpr Tables TABLES = Tables();
+
+};
+
+#endif
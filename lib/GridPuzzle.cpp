@@ -0,0 +1,260 @@
+/**
+ * @file GridPuzzle.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the public interface and private methods of the
+ * GridPuzzle class. For details about this class, see 'GridPuzzle.h'.
+ */
+
+//Protected includes
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <stdexcept>
+
+//Header includes
+#include "GridPuzzle.h"
+#include "Backtracker.h"
+
+using namespace std;
+
+/*** Public interface implementation ***/
+
+/**
+ * Public constructor. Starts out with an empty grid built from boxes of the given size
+ * (2, 3, 4, or 5, for grids of side 4, 9, 16, or 25).
+ *
+ * @param 	box_size 	The side length of a box
+ */
+GridPuzzle::GridPuzzle(int box_size) {
+	if(!isSupportedSide(box_size * box_size)) {
+		throw invalid_argument("Grids are supported with boxes of 2 to 5 cells per side.");
+	}
+	this->box_size = box_size;
+	this->starting_board.assign(this->getSide() * this->getSide(), -1);
+	this->current_board = this->starting_board;
+}
+
+//Public getter for the box_size member
+int GridPuzzle::getBoxSize() const {
+	return this->box_size;
+}
+
+//Returns the side length of the grid, which is also its number of digits
+int GridPuzzle::getSide() const {
+	return this->box_size * this->box_size;
+}
+
+/**
+ * Replaces the puzzle held by this object with one read from either grid format.
+ * Returns false (leaving the puzzle unchanged) if the text doesn't describe a grid of
+ * this object's size.
+ *
+ * @param 	text 	The puzzle, in the token or character format
+ */
+bool GridPuzzle::setState(const string& text) {
+	vector<int> cells;
+	if(!parse(text, this->getSide(), cells)) {
+		return false;
+	}
+	this->starting_board = cells;
+	this->current_board = cells;
+	return true;
+}
+
+//Public getter for the starting_board member
+vector<int> GridPuzzle::getStartingBoard() const {
+	return this->starting_board;
+}
+
+//Public getter for the current_board member
+vector<int> GridPuzzle::getCurrentBoard() const {
+	return this->current_board;
+}
+
+//Returns the counters collected by the most recent search
+const SearchStats& GridPuzzle::getStats() const {
+	return this->stats;
+}
+
+//Solves the puzzle. On success, current_board holds the solution.
+bool GridPuzzle::solve() {
+	return this->enumerate(1) > 0;
+}
+
+/**
+ * Counts the solutions of the current board, stopping as soon as 'limit' have been
+ * found (zero for no limit). The current_board member is left unchanged.
+ *
+ * @param 	limit 	The number of solutions at which to stop counting
+ */
+long GridPuzzle::countSolutions(long limit) {
+	vector<int> board = this->current_board;
+	long found = this->enumerate(limit);
+	this->current_board = board;
+	return found;
+}
+
+/**
+ * Prints the current board to standard output, dividing it into boxes. Cells are padded
+ * to the width of the largest digit, and missing values are printed as '.'.
+ */
+void GridPuzzle::printCurrentBoard() const {
+	int side = this->getSide();
+	int width = (side > 9) ? 2 : 1;
+	string divider = "+";
+	for(int b = 0; b < this->box_size; b++) {
+		divider += string(this->box_size * (width + 1) + 1, '-') + "+";
+	}
+	cout << "\n";
+	for(int row = 0; row < side; row++) {
+		if(row % this->box_size == 0) {
+			cout << divider << "\n";
+		}
+		for(int col = 0; col < side; col++) {
+			if(col % this->box_size == 0) {
+				cout << (col == 0 ? "| " : " | ");
+			} else {
+				cout << " ";
+			}
+			int val = this->current_board[(row * side) + col];
+			string text = (val == -1) ? "." : to_string(val);
+			cout << string(width - text.size(), ' ') << text;
+		}
+		cout << " |\n";
+	}
+	cout << divider << "\n";
+}
+
+/*** Static class method implementations ***/
+
+//Returns whether grids of a side length can be represented (4, 9, 16, or 25)
+bool GridPuzzle::isSupportedSide(int side) {
+	return side == 4 || side == 9 || side == 16 || side == 25;
+}
+
+//Returns the side length of the boxes of a grid with a supported side length
+int GridPuzzle::getBoxSizeOfSide(int side) {
+	return (side == 4) ? 2 : (side == 9) ? 3 : (side == 16) ? 4 : 5;
+}
+
+/**
+ * Reads a grid of the given side length from either format (see 'GridPuzzle.h') into a
+ * vector, with unsolved values denoted by -1. Returns false if the text holds the wrong
+ * number of cells or a value outside 1 to the side length.
+ *
+ * @param 	text 	The puzzle
+ * @param 	side 	The side length of the grid
+ * @param 	cells 	Receives the values of the cells
+ */
+bool GridPuzzle::parse(const string& text, int side, vector<int>& cells) {
+	int count = side * side;
+	//Split the text into tokens, also collecting its non-separator characters
+	vector<string> tokens;
+	string characters;
+	string token;
+	for(size_t i = 0; i <= text.size(); i++) {
+		char c = (i < text.size()) ? text[i] : ' ';
+		bool separator = (c == ' ' || c == '\t' || c == '\n' || c == '\r' ||
+						  c == '\v' || c == '\f' || c == ',' || c == '|');
+		if(!separator) {
+			token += c;
+			characters += c;
+		} else if(!token.empty()) {
+			tokens.push_back(token);
+			token.clear();
+		}
+	}
+	cells.assign(count, -1);
+	if(tokens.size() == count) {
+		for(int i = 0; i < count; i++) {
+			const string& t = tokens[i];
+			if(t == "." || t == "-") {
+				continue;
+			}
+			if(t.find_first_not_of("0123456789") != string::npos || t.size() > 2) {
+				return false;
+			}
+			int value = atoi(t.c_str());
+			if(value > side) {
+				return false;
+			}
+			cells[i] = (value == 0) ? -1 : value;
+		}
+		return true;
+	}
+	if(characters.size() == count) {
+		for(int i = 0; i < count; i++) {
+			char c = characters[i];
+			int value = (c >= '1' && c <= '9') ? c - '0' :
+						(c >= 'A' && c <= 'Z') ? c - 'A' + 10 :
+						(c >= 'a' && c <= 'z') ? c - 'a' + 10 :
+						(c == '.' || c == '0') ? -1 : side + 1;
+			if(value > side) {
+				return false;
+			}
+			cells[i] = value;
+		}
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Writes a grid into a string in the token format, on a single line: one token per
+ * cell, separated by spaces, with '.' for missing values.
+ *
+ * @param 	cells 	A reference to a vector describing a grid
+ * @param 	line 	A reference to the string which will receive the grid
+ */
+void GridPuzzle::formatLine(const vector<int>& cells, string& line) {
+	line.clear();
+	for(int i = 0; i < cells.size(); i++) {
+		if(i > 0) {
+			line += ' ';
+		}
+		line += (cells[i] == -1) ? "." : to_string(cells[i]);
+	}
+}
+
+/*** Private method implementations ***/
+
+/**
+ * Runs the engine specialized for boxes of BOX cells per side over the current board,
+ * leaving the last solution found (if any) in current_board.
+ *
+ * @param 	limit 	The number of solutions at which to stop (zero for no limit)
+ */
+template<int BOX>
+long GridPuzzle::search(long limit) {
+	GridBacktracker<BOX> engine;
+	engine.setCellOrder(GridBacktracker<BOX>::MINIMUM_REMAINING_VALUES);
+	engine.setPropagation(true);
+	this->stats.reset();
+	if(!engine.load(this->current_board)) {
+		return 0;
+	}
+	long found = engine.countSolutions(limit);
+	this->stats = engine.getStats();
+	if(found > 0) {
+		engine.getBoard(this->current_board);
+	}
+	return found;
+}
+
+//Dispatches to the engine specialized for this grid's size
+long GridPuzzle::enumerate(long limit) {
+	switch(this->box_size) {
+		case 2:
+			return this->search<2>(limit);
+		case 3:
+			return this->search<3>(limit);
+		case 4:
+			return this->search<4>(limit);
+		case 5:
+		default:
+			return this->search<5>(limit);
+	}
+}
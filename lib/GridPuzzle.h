@@ -0,0 +1,72 @@
+/**
+ * @file GridPuzzle.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the GridPuzzle class, which holds and solves a puzzle of any supported size
+ * (4x4, 9x9, 16x16, or 25x25) chosen at runtime, handing it to the GridBacktracker
+ * engine specialized for that size (with propagation and the minimum remaining values
+ * heuristic, which keep the larger grids tractable). The Sudoku class remains the home
+ * of 9x9 puzzles, with its selectable engines and options; GridPuzzle covers every size.
+ *
+ * Puzzles are read in either of two formats:
+ *
+ * Tokens: one token per cell, separated by whitespace, commas, or '|' characters. A
+ * token is a decimal number from 1 to the side length, or '.', '0', or '-' for a
+ * missing value, so cells of larger grids take more than one character. For example,
+ * "16 . 3 12 ...".
+ *
+ * Characters: exactly one character per cell (whitespace is ignored), with digits
+ * beyond 9 written as letters: 'A' (or 'a') for 10, 'B' for 11, and so on up to 'P'
+ * for 25. '.' and '0' mark missing values. This is the usual 9x9 format.
+ */
+
+#ifndef GRID_PUZZLE_H
+#define GRID_PUZZLE_H
+
+//Protected includes (for argument and return types)
+#include <string>
+#include <vector>
+
+//Header include (for member types)
+#include "SearchStats.h"
+
+using namespace std;
+
+class GridPuzzle {
+
+private:
+
+	int box_size;
+	//Unsolved values are denoted by a -1
+	vector<int> starting_board;
+	vector<int> current_board;
+	SearchStats stats;
+
+	template<int BOX> long search(long limit);
+	long enumerate(long limit);
+
+public:
+
+	GridPuzzle(int box_size = 3);
+
+	int getBoxSize() const;
+	int getSide() const;
+	bool setState(const string& text);
+	vector<int> getStartingBoard() const;
+	vector<int> getCurrentBoard() const;
+	const SearchStats& getStats() const;
+
+	bool solve();
+	long countSolutions(long limit = 0);
+	void printCurrentBoard() const;
+
+	//Static helper functions for the grid formats
+	static bool isSupportedSide(int side);
+	static int getBoxSizeOfSide(int side);
+	static bool parse(const string& text, int side, vector<int>& cells);
+	static void formatLine(const vector<int>& cells, string& line);
+
+};
+
+#endif
@@ -0,0 +1,205 @@
+/**
+ * @file ObjectPool.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the ObjectPool template, a free list of reusable objects. Objects are only
+ * created while the pool has none to spare; a released object goes back on the list
+ * as it is, keeping whatever buffers it has grown (such as the capacity of its strings),
+ * so once a workload has warmed the pool up, acquiring and releasing objects makes no
+ * heap allocations at all. Callers reset the fields they use before each reuse.
+ *
+ * The pool is thread-safe: objects may be acquired on one thread and released on
+ * another. Besides its shared list, a pool may keep a shelf per worker thread; a worker
+ * releasing onto its own shelf takes only that shelf's lock, and moves a batch of
+ * objects to the shared list when the shelf overflows. Once the shared list runs dry,
+ * acquire() takes a batch from the workers' shelves before creating anything, so an
+ * object is only created when there is truly none to spare.
+ */
+
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+//Protected includes (for member types)
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+
+template<typename T>
+class ObjectPool {
+
+public:
+
+	//The most objects a worker's shelf holds, and the number moved between lists at once
+	static const size_t SHELF_LIMIT = 32;
+	static const size_t BATCH = 16;
+
+private:
+
+	//The objects released by one worker thread
+	struct Shelf {
+		mutex lock;
+		vector<T*> objects;
+	};
+
+	mutex lock;
+	//Every object the pool has created, and those on the shared list
+	vector<T*> created;
+	vector<T*> available;
+	vector<Shelf> shelves;
+
+	T* create();
+	void share(T* const* objects, size_t count);
+
+	//Non-copyable
+	ObjectPool(const ObjectPool&);
+	ObjectPool& operator=(const ObjectPool&);
+
+public:
+
+	ObjectPool(int workers = 0);
+	~ObjectPool();
+
+	T* acquire();
+	void release(T* object);
+	void release(T* object, int worker);
+	size_t getCreated();
+
+};
+
+/*** Public interface implementation ***/
+
+/**
+ * Public constructor.
+ *
+ * @param 	workers 	The number of worker threads given a shelf of their own
+ */
+template<typename T>
+ObjectPool<T>::ObjectPool(int workers) : shelves(workers) {
+	for(size_t i = 0; i < this->shelves.size(); i++) {
+		//An overflowing shelf briefly holds one object past its limit
+		this->shelves[i].objects.reserve(SHELF_LIMIT + 1);
+	}
+}
+
+//Destructor. Deletes every object the pool created; none may still be acquired.
+template<typename T>
+ObjectPool<T>::~ObjectPool() {
+	for(size_t i = 0; i < this->created.size(); i++) {
+		delete this->created[i];
+	}
+}
+
+/**
+ * Returns an object for the caller's use until it is released: a released one if
+ * there is any, otherwise a new, default-constructed one. The shared list is tried
+ * first, then each worker's shelf in turn; a batch taken from a shelf is kept on the
+ * shared list for the calls that follow. No two locks are ever held at once.
+ */
+template<typename T>
+T* ObjectPool<T>::acquire() {
+	{
+		lock_guard<mutex> guard(this->lock);
+		if(!this->available.empty()) {
+			T* object = this->available.back();
+			this->available.pop_back();
+			return object;
+		}
+	}
+	for(size_t i = 0; i < this->shelves.size(); i++) {
+		Shelf& shelf = this->shelves[i];
+		T* taken[BATCH];
+		size_t count = 0;
+		{
+			lock_guard<mutex> guard(shelf.lock);
+			while(count < BATCH && !shelf.objects.empty()) {
+				taken[count++] = shelf.objects.back();
+				shelf.objects.pop_back();
+			}
+		}
+		if(count > 0) {
+			this->share(taken + 1, count - 1);
+			return taken[0];
+		}
+	}
+	return this->create();
+}
+
+/**
+ * Hands an object back to the pool's shared list, to be returned by a later call to
+ * acquire().
+ *
+ * @param 	object 	An object acquired from this pool
+ */
+template<typename T>
+void ObjectPool<T>::release(T* object) {
+	this->share(&object, 1);
+}
+
+/**
+ * Hands an object back to a worker's shelf (see above). Outside the range of workers
+ * the pool was constructed with, the object goes to the shared list instead.
+ *
+ * @param 	object 	An object acquired from this pool
+ * @param 	worker 	The index of the worker thread releasing the object
+ */
+template<typename T>
+void ObjectPool<T>::release(T* object, int worker) {
+	if(worker < 0 || worker >= (int)this->shelves.size()) {
+		this->release(object);
+		return;
+	}
+	Shelf& shelf = this->shelves[worker];
+	T* overflow[BATCH];
+	size_t count = 0;
+	{
+		lock_guard<mutex> guard(shelf.lock);
+		shelf.objects.push_back(object);
+		if(shelf.objects.size() > SHELF_LIMIT) {
+			while(count < BATCH) {
+				overflow[count++] = shelf.objects.back();
+				shelf.objects.pop_back();
+			}
+		}
+	}
+	this->share(overflow, count);
+}
+
+//Returns the number of objects the pool has created
+template<typename T>
+size_t ObjectPool<T>::getCreated() {
+	lock_guard<mutex> guard(this->lock);
+	return this->created.size();
+}
+
+/*** Private method implementations ***/
+
+//Creates a new object and records it, for when the pool has none to spare
+template<typename T>
+T* ObjectPool<T>::create() {
+	T* object = new T();
+	lock_guard<mutex> guard(this->lock);
+	this->created.push_back(object);
+	//Leave room to release every object without growing the list
+	this->available.reserve(this->created.size());
+	return object;
+}
+
+/**
+ * Pushes objects onto the shared list.
+ *
+ * @param 	objects 	The first of the objects to push
+ * @param 	count 		The number of objects to push (zero to do nothing)
+ */
+template<typename T>
+void ObjectPool<T>::share(T* const* objects, size_t count) {
+	if(count == 0) {
+		return;
+	}
+	lock_guard<mutex> guard(this->lock);
+	this->available.insert(this->available.end(), objects, objects + count);
+}
+
+#endif
@@ -0,0 +1,255 @@
+/**
+ * @file ParallelSearch.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the public interface and private methods of the
+ * ParallelSearch class. For details about this class, see 'ParallelSearch.h'.
+ */
+
+//Protected includes
+#include <vector>
+#include <mutex>
+#include <cstddef>
+
+//Header include
+#include "ParallelSearch.h"
+
+using namespace std;
+
+/*** Public interface implementation ***/
+
+/**
+ * Public constructor. Every worker of the pool gets its own copy of the given engine,
+ * so the parallel search uses the same propagation and ordering options.
+ *
+ * @param 	pool 			The pool whose workers will run the search
+ * @param 	configuration 	A Backtracker configured with the desired search options
+ */
+ParallelSearch::ParallelSearch(ThreadPool& pool, const Backtracker& configuration) :
+	pool(pool),
+	engines(pool.size(), configuration),
+	collectors(pool.size()) {
+	for(int i = 0; i < this->engines.size(); i++) {
+		this->engines[i].setCancellation(&this->cancellation);
+		this->collectors[i].search = this;
+	}
+	//Aim for a few dozen subtrees per worker; each level multiplies them by two or more
+	this->split_depth = 3;
+	for(int size = pool.size(); size > 1; size /= 2) {
+		this->split_depth++;
+	}
+	this->solutions = 0;
+	this->solution_limit = 0;
+	this->callback = NULL;
+	this->exhausted = false;
+}
+
+//Public getter for the split_depth member
+int ParallelSearch::getSplitDepth() const {
+	return this->split_depth;
+}
+
+/**
+ * Sets the depth below the root at which the tree stops being split into subtasks.
+ * Deeper splitting balances load better at the cost of more, smaller tasks.
+ *
+ * @param 	depth 	The split depth (zero searches the whole tree as one task)
+ */
+void ParallelSearch::setSplitDepth(int depth) {
+	this->split_depth = (depth > 0) ? depth : 0;
+}
+
+//Public getter for the limits member
+const SearchLimits& ParallelSearch::getLimits() const {
+	return this->limits;
+}
+
+//Public setter for the limits member; the limits apply to every later search
+void ParallelSearch::setLimits(const SearchLimits& limits) {
+	this->limits = limits;
+}
+
+//Returns whether the most recent search stopped because it ran out of budget
+bool ParallelSearch::isExhausted() const {
+	return this->exhausted;
+}
+
+/**
+ * Searches for a solution to a board on every worker of the pool at once, returning
+ * as soon as any of them finds one.
+ *
+ * @param 	state 		A reference to a board
+ * @param 	solution 	Receives the solution, if one is found
+ */
+bool ParallelSearch::solve(const Board& state, Board& solution) {
+	if(this->start(state, 1, NULL) == 0) {
+		return false;
+	}
+	solution = this->solution;
+	return true;
+}
+
+/**
+ * Counts the solutions of a board on every worker of the pool at once, stopping once
+ * 'limit' have been found. If a callback is given, it receives each solution; calls
+ * to it are serialized, but may come from any worker, in any order.
+ *
+ * @param 	state 		A reference to a board
+ * @param 	limit 		The number of solutions at which to stop (zero for no limit)
+ * @param 	callback 	If not NULL, receives each solution, and may stop the search by
+ * 						returning false
+ */
+long ParallelSearch::countSolutions(const Board& state, long limit, SolutionCallback* callback) {
+	return this->start(state, limit, callback);
+}
+
+//Returns the counters collected over every worker by the most recent search
+const SearchStats& ParallelSearch::getStats() const {
+	return this->stats;
+}
+
+/*** Private method implementations ***/
+
+/**
+ * Resets the search state, queues the root of the tree, and waits for the pool to
+ * finish. Returns the number of solutions found.
+ */
+long ParallelSearch::start(const Board& state, long limit, SolutionCallback* callback) {
+	this->cancellation.reset();
+	this->solutions = 0;
+	this->solution_limit = limit;
+	this->callback = callback;
+	this->stats.reset();
+	this->exhausted = false;
+	Node root;
+	root.cells = state;
+	root.depth = 0;
+	this->pool.submit([this, root](int worker) {
+		this->run(root, worker);
+	});
+	this->pool.wait();
+	return this->solutions;
+}
+
+/**
+ * Runs one task: branches on a node of the tree and queues its children, or (at the
+ * split depth) searches the node's whole subtree.
+ *
+ * @param 	node 	The node to expand
+ * @param 	worker 	The index of the worker running the task
+ */
+void ParallelSearch::run(const Node& node, int worker) {
+	if(this->cancellation.isCancelled()) {
+		return;
+	}
+	Backtracker& engine = this->engines[worker];
+	SearchLimits budget;
+	if(!this->getSubtreeLimits(budget)) {
+		return;
+	}
+	engine.setLimits(budget);
+	if(!engine.load(node.cells)) {
+		return;
+	}
+	if(node.depth >= this->split_depth) {
+		this->searchSubtree(engine, worker, node.depth);
+		return;
+	}
+	int index;
+	int digits[9];
+	int count = engine.split(index, digits);
+	if(index == 81) {
+		//Propagation alone completed the board
+		this->searchSubtree(engine, worker, node.depth);
+		return;
+	}
+	Node child;
+	engine.getBoard(child.cells);
+	child.depth = node.depth + 1;
+	//Queue the children in reverse, so this worker (taking from the back of its deque)
+	//explores them in the engine's preferred order, while thieves take the last ones
+	for(int k = count - 1; k >= 0; k--) {
+		child.cells.set(index, (uint8_t)digits[k]);
+		this->pool.submit([this, child](int w) {
+			this->run(child, w);
+		});
+	}
+}
+
+/**
+ * Searches the whole subtree below the board loaded into a worker's engine, adding the
+ * engine's counters to the search's.
+ *
+ * @param 	engine 	The worker's engine, holding the subtree's root
+ * @param 	worker 	The index of the worker
+ * @param 	depth 	The depth of the subtree's root within the whole tree
+ */
+void ParallelSearch::searchSubtree(Backtracker& engine, int worker, int depth) {
+	engine.countSolutions(0, &this->collectors[worker]);
+	const SearchStats& local = engine.getStats();
+	lock_guard<mutex> guard(this->result_lock);
+	this->stats.add(local);
+	SEARCH_STATS_ONLY(this->stats.recordDepth(depth + local.max_depth));
+	if(engine.isExhausted()) {
+		this->exhausted = true;
+		this->cancellation.cancel();
+	}
+}
+
+/**
+ * Gives the limits for a worker's next task: the search's own, with whatever is left
+ * of its node budget. Returns false (and stops the search) if the budget has already
+ * run out.
+ *
+ * @param 	subtree 	Receives the limits
+ */
+bool ParallelSearch::getSubtreeLimits(SearchLimits& subtree) {
+	subtree = this->limits;
+	if(!this->limits.isLimited()) {
+		return true;
+	}
+	lock_guard<mutex> guard(this->result_lock);
+	if(this->limits.isExhausted(this->stats.nodes)) {
+		this->exhausted = true;
+		this->cancellation.cancel();
+		return false;
+	}
+	if(this->limits.getMaxNodes() > 0) {
+		subtree.setMaxNodes(this->limits.getMaxNodes() - this->stats.nodes);
+	}
+	return true;
+}
+
+//Forwards a worker's solution to the search, and stops the worker once it should stop
+bool ParallelSearch::Collector::onSolution(const int* board) {
+	return this->search->recordSolution(board);
+}
+
+/**
+ * Counts a solution found by any worker, keeps the first one (for solve()), and passes
+ * it to the callback, if any. Trips the cancellation token once the limit is reached
+ * or the callback asks to stop. Returns false if the calling worker should stop.
+ * Solutions are rare next to search nodes, so they are simply serialized by a lock.
+ *
+ * @param 	board 	The solution
+ */
+bool ParallelSearch::recordSolution(const int* board) {
+	lock_guard<mutex> guard(this->result_lock);
+	if(this->cancellation.isCancelled()) {
+		//Another worker has already ended the search
+		return false;
+	}
+	if(this->solutions == 0) {
+		for(int i = 0; i < 81; i++) {
+			this->solution.set(i, (uint8_t)board[i]);
+		}
+	}
+	this->solutions++;
+	if((this->callback != NULL && !this->callback->onSolution(board)) ||
+	   (this->solution_limit > 0 && this->solutions >= this->solution_limit)) {
+		this->cancellation.cancel();
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file ParallelSearch.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the ParallelSearch class, which spreads the search of a single board over
+ * the workers of a ThreadPool. The search tree is split at shallow depths: each task
+ * takes one node of the tree, branches on it, and queues a subtask for every child,
+ * until the split depth is reached and a subtree is searched sequentially by the
+ * worker's own Backtracker. Idle workers steal queued subtrees from busy ones. When
+ * looking for a single solution (or once a solution limit is reached), the first
+ * worker to finish trips a CancellationToken that every other worker polls, so the
+ * remaining subtrees are abandoned cooperatively.
+ *
+ * A search can be given SearchLimits. The deadline and cancellation token bound every
+ * worker's subtree; the node budget is shared, each subtree getting whatever is left of
+ * it when the subtree starts (so with several workers, it can be overrun by a little).
+ * A worker that runs out of budget trips the token that stops the others.
+ */
+
+#ifndef PARALLEL_SEARCH_H
+#define PARALLEL_SEARCH_H
+
+//Protected includes (for argument, return, and member types)
+#include <vector>
+#include <mutex>
+#include <cstddef>
+
+//Header includes (for member types)
+#include "Backtracker.h"
+#include "ThreadPool.h"
+#include "CancellationToken.h"
+#include "SearchStats.h"
+#include "SearchLimits.h"
+
+using namespace std;
+
+class ParallelSearch {
+
+private:
+
+	//One node of the search tree: a board, and its depth below the root
+	struct Node {
+		Board cells;
+		int depth;
+	};
+
+	//Receives the solutions found by a worker's Backtracker
+	class Collector : public SolutionCallback {
+	public:
+		ParallelSearch* search;
+		bool onSolution(const int* board);
+	};
+
+	ThreadPool& pool;
+	//One engine per worker, each configured like the template engine
+	vector<Backtracker> engines;
+	vector<Collector> collectors;
+	int split_depth;
+
+	//State of the current call to solve() or countSolutions()
+	CancellationToken cancellation;
+	long solutions;
+	long solution_limit;
+	SolutionCallback* callback;
+	mutex result_lock;
+	Board solution;
+	SearchStats stats;
+	SearchLimits limits;
+	bool exhausted;
+
+	void run(const Node& node, int worker);
+	void searchSubtree(Backtracker& engine, int worker, int depth);
+	bool recordSolution(const int* board);
+	bool getSubtreeLimits(SearchLimits& subtree);
+	long start(const Board& state, long limit, SolutionCallback* callback);
+
+	//Non-copyable
+	ParallelSearch(const ParallelSearch&);
+	ParallelSearch& operator=(const ParallelSearch&);
+
+public:
+
+	ParallelSearch(ThreadPool& pool, const Backtracker& configuration);
+
+	int getSplitDepth() const;
+	void setSplitDepth(int depth);
+	const SearchLimits& getLimits() const;
+	void setLimits(const SearchLimits& limits);
+	bool isExhausted() const;
+
+	bool solve(const Board& state, Board& solution);
+	long countSolutions(const Board& state, long limit, SolutionCallback* callback = NULL);
+	const SearchStats& getStats() const;
+
+};
+
+#endif
@@ -0,0 +1,135 @@
+/**
+ * @file PuzzleReader.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the StreamPuzzleReader and MappedPuzzleReader classes.
+ * For details about these classes, see 'PuzzleReader.h'.
+ */
+
+//Protected includes
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+//Header includes
+#include "PuzzleReader.h"
+#include "BatchSolver.h"
+
+using namespace std;
+
+/*** StreamPuzzleReader implementation ***/
+
+//Public constructor; the stream must outlive the reader
+StreamPuzzleReader::StreamPuzzleReader(istream& input) : input(input) {}
+
+//Reads the next puzzle line into the storage string, and points the view at it
+bool StreamPuzzleReader::next(PuzzleView& view, string& storage) {
+	if(!BatchSolver::readPuzzleLine(this->input, storage)) {
+		return false;
+	}
+	view.data = storage.data();
+	view.size = storage.size();
+	view.decoded = false;
+	return true;
+}
+
+/*** MappedPuzzleReader implementation ***/
+
+//Public constructor. The reader starts out closed.
+MappedPuzzleReader::MappedPuzzleReader() {
+	this->mapping = NULL;
+	this->length = 0;
+	this->cursor = 0;
+}
+
+MappedPuzzleReader::~MappedPuzzleReader() {
+	this->close();
+}
+
+/**
+ * Maps a corpus file into memory, closing any file mapped before. Returns false if the
+ * file can't be opened or mapped (for instance, if it is a pipe rather than a regular
+ * file); an empty file opens successfully and yields no puzzles.
+ *
+ * @param 	path 	The path of the corpus
+ */
+bool MappedPuzzleReader::open(const string& path) {
+	this->close();
+	int descriptor = ::open(path.c_str(), O_RDONLY);
+	if(descriptor < 0) {
+		return false;
+	}
+	struct stat info;
+	if(fstat(descriptor, &info) != 0 || !S_ISREG(info.st_mode)) {
+		::close(descriptor);
+		return false;
+	}
+	this->length = (size_t)info.st_size;
+	this->cursor = 0;
+	if(this->length == 0) {
+		//Nothing to map, but an empty corpus is still a corpus
+		::close(descriptor);
+		this->mapping = "";
+		return true;
+	}
+	void* address = mmap(NULL, this->length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+	//The mapping keeps the file alive on its own
+	::close(descriptor);
+	if(address == MAP_FAILED) {
+		this->length = 0;
+		return false;
+	}
+	//Lines are scanned front to back exactly once, so the kernel can read ahead of the
+	//cursor and drop pages behind it rather than holding the whole corpus
+	madvise(address, this->length, MADV_SEQUENTIAL);
+	this->mapping = (const char*)address;
+	return true;
+}
+
+//Unmaps the corpus; views handed out before become invalid
+void MappedPuzzleReader::close() {
+	if(this->mapping != NULL && this->length > 0) {
+		munmap((void*)this->mapping, this->length);
+	}
+	this->mapping = NULL;
+	this->length = 0;
+	this->cursor = 0;
+}
+
+bool MappedPuzzleReader::isOpen() const {
+	return this->mapping != NULL;
+}
+
+//Returns the size of the mapped corpus, in bytes
+size_t MappedPuzzleReader::size() const {
+	return this->length;
+}
+
+/**
+ * Points the view at the next puzzle line of the mapping (no storage string is ever
+ * needed, so it goes unnamed). Views stay valid until the reader is closed.
+ */
+bool MappedPuzzleReader::next(PuzzleView& view, string&) {
+	while(this->cursor < this->length) {
+		const char* start = this->mapping + this->cursor;
+		size_t remaining = this->length - this->cursor;
+		const char* end = (const char*)memchr(start, '\n', remaining);
+		size_t size = (end != NULL) ? (size_t)(end - start) : remaining;
+		this->cursor += (end != NULL) ? size + 1 : size;
+		if(size > 0 && start[size - 1] == '\r') {
+			size--;
+		}
+		if(!BatchSolver::isSkippedLine(start, size)) {
+			view.data = start;
+			view.size = size;
+			view.decoded = false;
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file PuzzleReader.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the PuzzleReader interface, which yields the puzzle lines of a corpus in
+ * the one-line format one at a time, along with its two implementations:
+ *
+ * StreamPuzzleReader reads lines from an istream (for pipes and standard input).
+ *
+ * MappedPuzzleReader memory-maps a corpus file and scans its lines in place: each puzzle
+ * is handed out as a view of the mapped bytes, so nothing is copied between the page
+ * cache and the solver. The mapping is advised for sequential access, so the kernel
+ * reads ahead aggressively and is free to drop pages once they have been scanned.
+ *
+ * Readers skip blank lines and '#' comments, and strip line terminators. A reader of a
+ * binary corpus (see 'BinaryFormat.h') hands out the boards it decodes as they are,
+ * rather than as lines of text.
+ */
+
+#ifndef PUZZLE_READER_H
+#define PUZZLE_READER_H
+
+//Protected includes (for argument and return types)
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+//Header include (for member types)
+#include "Board.h"
+
+using namespace std;
+
+//A view of one line of a corpus; the bytes belong to the reader or to its caller. A
+//puzzle which was decoded straight into a board is held in 'board' instead, with
+//'decoded' set and no line.
+struct PuzzleView {
+
+	const char* data;
+	size_t size;
+	Board board;
+	bool decoded;
+
+	PuzzleView() {
+		this->data = NULL;
+		this->size = 0;
+		this->decoded = false;
+	}
+
+};
+
+class PuzzleReader {
+
+public:
+
+	virtual ~PuzzleReader() {}
+
+	/**
+	 * Moves to the next puzzle line, pointing a view at it. Returns false once the corpus
+	 * is exhausted. Readers that can't hand out views of their own bytes copy the line
+	 * into the given storage string and point the view there, so the view stays valid for
+	 * as long as the caller leaves that string alone. Readers that decode boards rather
+	 * than read lines may place the board in the view instead (see PuzzleView).
+	 *
+	 * @param 	view 		Receives the line
+	 * @param 	storage 	A string the reader may copy the line into
+	 */
+	virtual bool next(PuzzleView& view, string& storage) = 0;
+
+};
+
+class StreamPuzzleReader : public PuzzleReader {
+
+private:
+
+	istream& input;
+
+public:
+
+	StreamPuzzleReader(istream& input);
+
+	bool next(PuzzleView& view, string& storage);
+
+};
+
+class MappedPuzzleReader : public PuzzleReader {
+
+private:
+
+	const char* mapping;
+	size_t length;
+	//Offset of the first byte not yet scanned
+	size_t cursor;
+
+	//Not copyable: the reader owns its mapping
+	MappedPuzzleReader(const MappedPuzzleReader& other);
+	MappedPuzzleReader& operator=(const MappedPuzzleReader& other);
+
+public:
+
+	MappedPuzzleReader();
+	~MappedPuzzleReader();
+
+	bool open(const string& path);
+	void close();
+	bool isOpen() const;
+	size_t size() const;
+
+	bool next(PuzzleView& view, string& storage);
+
+};
+
+#endif
@@ -0,0 +1,126 @@
+/**
+ * @file SearchLimits.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the SearchLimits class, a budget on a single search: a wall-clock deadline,
+ * a maximum number of search nodes, and a CancellationToken another thread can trip.
+ * Any combination of the three may be set; a search stops as soon as any one of them
+ * runs out, and reports that its budget was exhausted rather than that the board has no
+ * solution.
+ *
+ * Reading the clock costs far more than visiting a node, so engines don't test the
+ * limits at every node. Instead they compare their node counter against a checkpoint
+ * (see BudgetedSearch::isOverBudget), and only test the limits every CHECK_INTERVAL nodes, or
+ * exactly at the node budget if that comes first. A search with no limits set never
+ * reaches a checkpoint at all.
+ */
+
+#ifndef SEARCH_LIMITS_H
+#define SEARCH_LIMITS_H
+
+//Protected includes (for member types)
+#include <chrono>
+#include <climits>
+#include <cstddef>
+
+//Header includes (for member types)
+#include "CancellationToken.h"
+
+using namespace std;
+
+class SearchLimits {
+
+public:
+
+	typedef chrono::steady_clock Clock;
+
+	//Nodes visited between two tests of the deadline and the cancellation token
+	static const long CHECK_INTERVAL = 1024;
+
+private:
+
+	bool has_deadline;
+	Clock::time_point deadline;
+	//Zero for no node budget
+	long max_nodes;
+	//Not owned; NULL for none
+	const CancellationToken* cancellation;
+
+public:
+
+	SearchLimits() {
+		this->has_deadline = false;
+		this->max_nodes = 0;
+		this->cancellation = NULL;
+	}
+
+	//Public getter/setter for the deadline; clearDeadline removes it
+	bool hasDeadline() const {
+		return this->has_deadline;
+	}
+
+	Clock::time_point getDeadline() const {
+		return this->deadline;
+	}
+
+	void setDeadline(Clock::time_point deadline) {
+		this->has_deadline = true;
+		this->deadline = deadline;
+	}
+
+	void clearDeadline() {
+		this->has_deadline = false;
+	}
+
+	//Sets the deadline to a number of seconds from now
+	void setTimeout(double seconds) {
+		this->setDeadline(Clock::now() + chrono::duration_cast<Clock::duration>(chrono::duration<double>(seconds)));
+	}
+
+	//Public getter/setter for the max_nodes member (zero for no node budget)
+	long getMaxNodes() const {
+		return this->max_nodes;
+	}
+
+	void setMaxNodes(long nodes) {
+		this->max_nodes = (nodes > 0) ? nodes : 0;
+	}
+
+	//Public getter/setter for the cancellation member (NULL for none)
+	const CancellationToken* getCancellation() const {
+		return this->cancellation;
+	}
+
+	void setCancellation(const CancellationToken* token) {
+		this->cancellation = token;
+	}
+
+	//Returns whether any limit is set at all
+	bool isLimited() const {
+		return this->has_deadline || this->max_nodes > 0 || this->cancellation != NULL;
+	}
+
+	//Returns whether a search that has visited the given number of nodes should stop
+	bool isExhausted(long nodes) const {
+		return (this->max_nodes > 0 && nodes >= this->max_nodes) ||
+			   (this->cancellation != NULL && this->cancellation->isCancelled()) ||
+			   (this->has_deadline && Clock::now() >= this->deadline);
+	}
+
+	//Returns the node count at which a search that has visited the given number of
+	//nodes should next test the limits
+	long getNextCheck(long nodes) const {
+		if(!this->isLimited()) {
+			return LONG_MAX;
+		}
+		long next = nodes + CHECK_INTERVAL;
+		if(this->max_nodes > 0 && this->max_nodes < next) {
+			next = (this->max_nodes > nodes) ? this->max_nodes : nodes + 1;
+		}
+		return next;
+	}
+
+};
+
+#endif
@@ -0,0 +1,141 @@
+/**
+ * @file SearchStats.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the SearchStats structure, which collects counters from a single call to
+ * a search engine's solve method, and the PhaseTimer class used to time its phases.
+ *
+ * The node and propagation counters are always kept. The finer instrumentation (the
+ * depth, branching, and backtracking counters, and the time spent in each phase) is
+ * written through the SEARCH_STATS_ONLY macro, and compiles to nothing when the
+ * project is built with SEARCH_STATS defined to 0; its fields then stay at zero.
+ */
+
+#ifndef SEARCH_STATS_H
+#define SEARCH_STATS_H
+
+//Protected includes (for member types)
+#include <chrono>
+
+using namespace std;
+
+#ifndef SEARCH_STATS
+#define SEARCH_STATS 1
+#endif
+
+#if SEARCH_STATS
+#define SEARCH_STATS_ONLY(statement) statement
+#else
+#define SEARCH_STATS_ONLY(statement)
+#endif
+
+struct SearchStats {
+
+	//Search nodes visited (calls made to an engine's recursive search)
+	long nodes;
+	//Cells filled by propagation because only one digit could be placed in them
+	long naked_singles;
+	//Cells filled by propagation because a digit fit nowhere else in a row, column, or square
+	long hidden_singles;
+	//Candidates removed by pointing/claiming (locked candidates)
+	long locked_candidates;
+	//Cells the search branched on, and the digits it tried at them
+	long branches;
+	long candidates_tried;
+	//Digits tried at a branch whose subtree held no (further) solution
+	long backtracks;
+	//The deepest level of branching reached, the root being depth zero
+	int max_depth;
+	//Time spent loading (and checking) the board, in propagation, and in the rest of
+	//the search, in seconds. Propagation time is summed over every thread that searched.
+	double load_seconds;
+	double propagation_seconds;
+	double search_seconds;
+
+	SearchStats() {
+		this->reset();
+	}
+
+	void reset() {
+		this->nodes = 0;
+		this->naked_singles = 0;
+		this->hidden_singles = 0;
+		this->locked_candidates = 0;
+		this->branches = 0;
+		this->candidates_tried = 0;
+		this->backtracks = 0;
+		this->max_depth = 0;
+		this->load_seconds = 0;
+		this->propagation_seconds = 0;
+		this->search_seconds = 0;
+	}
+
+	//Adds the counters of another search (such as one of several threads) to these
+	void add(const SearchStats& other) {
+		this->nodes += other.nodes;
+		this->naked_singles += other.naked_singles;
+		this->hidden_singles += other.hidden_singles;
+		this->locked_candidates += other.locked_candidates;
+		this->branches += other.branches;
+		this->candidates_tried += other.candidates_tried;
+		this->backtracks += other.backtracks;
+		this->recordDepth(other.max_depth);
+		this->load_seconds += other.load_seconds;
+		this->propagation_seconds += other.propagation_seconds;
+		this->search_seconds += other.search_seconds;
+	}
+
+	void recordDepth(int depth) {
+		if(depth > this->max_depth) {
+			this->max_depth = depth;
+		}
+	}
+
+	//Total number of cells filled by propagation rather than by search
+	long getPropagatedCells() const {
+		return this->naked_singles + this->hidden_singles;
+	}
+
+	//Average number of digits tried at each cell the search branched on
+	double getCandidatesPerBranch() const {
+		return (this->branches > 0) ? ((double)this->candidates_tried / this->branches) : 0;
+	}
+
+	double getTotalSeconds() const {
+		return this->load_seconds + this->propagation_seconds + this->search_seconds;
+	}
+
+};
+
+//Measures the time between laps; with SEARCH_STATS disabled, never reads the clock
+//and every lap is zero
+class PhaseTimer {
+
+private:
+
+#if SEARCH_STATS
+	chrono::steady_clock::time_point start;
+#endif
+
+public:
+
+	PhaseTimer() {
+		SEARCH_STATS_ONLY(this->start = chrono::steady_clock::now());
+	}
+
+	//Returns the seconds elapsed since the timer was created or last lapped
+	double lap() {
+#if SEARCH_STATS
+		chrono::steady_clock::time_point now = chrono::steady_clock::now();
+		double seconds = chrono::duration<double>(now - this->start).count();
+		this->start = now;
+		return seconds;
+#else
+		return 0;
+#endif
+	}
+
+};
+
+#endif
@@ -0,0 +1,263 @@
+/**
+ * @file SolutionCache.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the public interface and private methods of the
+ * SolutionCache class. For details about this class, see 'SolutionCache.h'.
+ */
+
+//Protected includes
+#include <fstream>
+#include <string>
+
+//Header includes
+#include "SolutionCache.h"
+#include "BoardKernels.h"
+
+using namespace std;
+
+/*** Public interface implementation ***/
+
+/**
+ * Public constructor. The cache starts out empty.
+ *
+ * @param 	capacity 	The number of entries kept before the least recently used is dropped
+ */
+SolutionCache::SolutionCache(size_t capacity) {
+	this->capacity = (capacity > 0) ? capacity : 1;
+	this->hits = 0;
+	this->misses = 0;
+}
+
+//Public getter for the capacity member
+size_t SolutionCache::getCapacity() const {
+	return this->capacity;
+}
+
+//Returns the number of entries held
+size_t SolutionCache::size() const {
+	lock_guard<mutex> guard(this->lock);
+	return this->entries.size();
+}
+
+//Public getter for the hits member
+long SolutionCache::getHits() const {
+	lock_guard<mutex> guard(this->lock);
+	return this->hits;
+}
+
+//Public getter for the misses member
+long SolutionCache::getMisses() const {
+	lock_guard<mutex> guard(this->lock);
+	return this->misses;
+}
+
+/**
+ * Looks up a canonical puzzle, counting a hit or a miss. Returns true if it is cached,
+ * in which case it becomes the most recently used entry.
+ *
+ * @param 	canonical 	A puzzle in canonical form
+ * @param 	solution 	Receives the canonical puzzle's solution, if it has one
+ * @param 	solvable 	Receives whether the canonical puzzle has a solution
+ */
+bool SolutionCache::find(const Board& canonical, Board& solution, bool& solvable) {
+	string key;
+	getKey(canonical, key);
+	lock_guard<mutex> guard(this->lock);
+	unordered_map<string, list<Entry>::iterator>::iterator found = this->index.find(key);
+	if(found == this->index.end()) {
+		this->misses++;
+		return false;
+	}
+	this->hits++;
+	this->entries.splice(this->entries.begin(), this->entries, found->second);
+	solution = found->second->solution;
+	solvable = found->second->solvable;
+	return true;
+}
+
+/**
+ * Stores the solution of a canonical puzzle as the most recently used entry, dropping
+ * the least recently used entry if the cache is full.
+ *
+ * @param 	canonical 	A puzzle in canonical form
+ * @param 	solution 	The canonical puzzle's solution (ignored if it has none)
+ * @param 	solvable 	Whether the canonical puzzle has a solution
+ */
+void SolutionCache::insert(const Board& canonical, const Board& solution, bool solvable) {
+	string key;
+	getKey(canonical, key);
+	lock_guard<mutex> guard(this->lock);
+	this->store(key, solution, solvable);
+}
+
+//Removes every entry and resets the hit and miss counts
+void SolutionCache::clear() {
+	lock_guard<mutex> guard(this->lock);
+	this->entries.clear();
+	this->index.clear();
+	this->hits = 0;
+	this->misses = 0;
+}
+
+/**
+ * Writes every entry to a file, least recently used first, so that loading the file
+ * restores the same order. Returns false if the file could not be written.
+ *
+ * @param 	path 	The path of the file
+ */
+bool SolutionCache::save(const string& path) const {
+	ofstream output(path.c_str());
+	if(!output.is_open()) {
+		return false;
+	}
+	lock_guard<mutex> guard(this->lock);
+	string line;
+	for(list<Entry>::const_reverse_iterator entry = this->entries.rbegin(); entry != this->entries.rend(); entry++) {
+		line = entry->key;
+		line += ' ';
+		if(entry->solvable) {
+			string solution;
+			getKey(entry->solution, solution);
+			line += solution;
+		} else {
+			line += "unsolvable";
+		}
+		line += '\n';
+		output.write(line.data(), line.size());
+	}
+	output.flush();
+	return output.good();
+}
+
+/**
+ * Adds the entries saved in a file, each becoming more recently used than the ones
+ * before it. Every entry is checked before it is stored, since a bad one would be
+ * handed out as the answer to a whole class of puzzles: lines that are not well-formed,
+ * puzzles that could never have been cached, and solutions that are incomplete, break
+ * a rule, or disagree with their puzzle's givens are all skipped. Returns the number
+ * of entries read, or -1 if the file could not be opened.
+ *
+ * @param 	path 	The path of the file
+ */
+long SolutionCache::load(const string& path) {
+	ifstream input(path.c_str());
+	if(!input.is_open()) {
+		return -1;
+	}
+	long count = 0;
+	string line;
+	Board canonical;
+	Board solution;
+	while(getline(input, line)) {
+		if(line.size() < 83 || line[81] != ' ') {
+			continue;
+		}
+		canonical.parse(line.data(), 81);
+		if(!isCacheable(canonical)) {
+			continue;
+		}
+		string value = line.substr(82);
+		bool solvable = value != "unsolvable";
+		if(solvable) {
+			if(value.size() != 81) {
+				continue;
+			}
+			solution.parse(value.data(), 81);
+			if(!isSolutionOf(solution, canonical)) {
+				continue;
+			}
+		}
+		string key;
+		getKey(canonical, key);
+		lock_guard<mutex> guard(this->lock);
+		this->store(key, solution, solvable);
+		count++;
+	}
+	return count;
+}
+
+/*** Static class method implementations ***/
+
+/**
+ * Returns a boolean value indicating whether a puzzle should go through the cache: it
+ * must hold only digits and missing values, and at least MINIMUM_CLUES digits. Puzzles
+ * with fewer clues leave so many transforms tied that canonicalizing them can cost far
+ * more than solving them (and no puzzle with fewer than 17 clues has a unique solution).
+ *
+ * @param 	puzzle 	A board
+ */
+bool SolutionCache::isCacheable(const Board& puzzle) {
+	int clues = 0;
+	for(int i = 0; i < 81; i++) {
+		uint8_t value = puzzle.get(i);
+		if(value == Board::INVALID) {
+			return false;
+		}
+		clues += (value != 0) ? 1 : 0;
+	}
+	return clues >= MINIMUM_CLUES;
+}
+
+/**
+ * Returns a boolean value indicating whether a board is a solution of a puzzle: every
+ * cell holds a digit, no row, column, or square repeats one, and every given of the
+ * puzzle is kept.
+ *
+ * @param 	solution 	The board to check
+ * @param 	puzzle 		The puzzle it should solve
+ */
+bool SolutionCache::isSolutionOf(const Board& solution, const Board& puzzle) {
+	for(int i = 0; i < 81; i++) {
+		uint8_t value = solution.get(i);
+		if(value == 0 || value == Board::INVALID || (!puzzle.isEmpty(i) && puzzle.get(i) != value)) {
+			return false;
+		}
+	}
+	return BoardKernels::isValid(solution.data());
+}
+
+/**
+ * Writes a board in the one-line format ('.' for a missing value), the form in which
+ * boards are used as keys.
+ *
+ * @param 	board 	A board
+ * @param 	key 	Receives the board's 81 characters
+ */
+void SolutionCache::getKey(const Board& board, string& key) {
+	key.resize(81);
+	for(int i = 0; i < 81; i++) {
+		key[i] = board.isEmpty(i) ? '.' : (char)('0' + board.get(i));
+	}
+}
+
+/*** Private method implementations ***/
+
+/**
+ * Stores an entry as the most recently used, replacing any entry with the same key and
+ * dropping the least recently used entry if the cache is full. The lock must be held.
+ *
+ * @param 	key 		The canonical puzzle in the one-line format
+ * @param 	solution 	The canonical puzzle's solution
+ * @param 	solvable 	Whether the canonical puzzle has a solution
+ */
+void SolutionCache::store(const string& key, const Board& solution, bool solvable) {
+	unordered_map<string, list<Entry>::iterator>::iterator found = this->index.find(key);
+	if(found != this->index.end()) {
+		found->second->solution = solution;
+		found->second->solvable = solvable;
+		this->entries.splice(this->entries.begin(), this->entries, found->second);
+		return;
+	}
+	if(this->entries.size() >= this->capacity) {
+		this->index.erase(this->entries.back().key);
+		this->entries.pop_back();
+	}
+	Entry entry;
+	entry.key = key;
+	entry.solution = solution;
+	entry.solvable = solvable;
+	this->entries.push_front(entry);
+	this->index[key] = this->entries.begin();
+}
@@ -0,0 +1,81 @@
+/**
+ * @file SolutionCache.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the SolutionCache class, a bounded, least-recently-used map from canonical
+ * puzzles (see 'BoardTransform.h') to their solutions. Because the key is the canonical
+ * form, one entry answers for every puzzle in its equivalence class: a solver holding
+ * a cache canonicalizes each puzzle, and on a hit maps the stored solution back through
+ * the puzzle's transform instead of searching. Puzzles found to have no solution are
+ * cached too.
+ *
+ * A cache may be shared by any number of solvers and threads; every operation takes a
+ * lock. Its contents can be saved to a file and loaded again, one entry per line: the
+ * canonical puzzle in the one-line format, a space, and the solution (or "unsolvable").
+ */
+
+#ifndef SOLUTION_CACHE_H
+#define SOLUTION_CACHE_H
+
+//Protected includes (for argument, return, and member types)
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+//Header includes (for argument and member types)
+#include "Board.h"
+
+using namespace std;
+
+class SolutionCache {
+
+private:
+
+	struct Entry {
+		string key;
+		Board solution;
+		bool solvable;
+	};
+
+	//Entries from most to least recently used, and each entry's place in that list
+	list<Entry> entries;
+	unordered_map<string, list<Entry>::iterator> index;
+	size_t capacity;
+	long hits;
+	long misses;
+	mutable mutex lock;
+
+	void store(const string& key, const Board& solution, bool solvable);
+
+	//Non-copyable
+	SolutionCache(const SolutionCache&);
+	SolutionCache& operator=(const SolutionCache&);
+
+public:
+
+	SolutionCache(size_t capacity);
+
+	size_t getCapacity() const;
+	size_t size() const;
+	long getHits() const;
+	long getMisses() const;
+
+	bool find(const Board& canonical, Board& solution, bool& solvable);
+	void insert(const Board& canonical, const Board& solution, bool solvable);
+	void clear();
+	bool save(const string& path) const;
+	long load(const string& path);
+
+	//Static helper functions
+	static bool isCacheable(const Board& puzzle);
+	static bool isSolutionOf(const Board& solution, const Board& puzzle);
+	static void getKey(const Board& board, string& key);
+
+	//Puzzles with fewer clues are neither cached nor canonicalized (see isCacheable)
+	static const int MINIMUM_CLUES = 17;
+
+};
+
+#endif
@@ -0,0 +1,352 @@
+/**
+ * @file SolutionIterator.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the SolutionIterator template, a search for grids of any supported size
+ * (see 'GridGeometry.h') that yields solutions one at a time, on demand. Instead of
+ * recursing, the search keeps an explicit stack of frames, preallocated with one frame
+ * per cell, so its memory is fixed whatever the grid or the depth of the search, and it
+ * can stop between any two nodes and carry on later from exactly where it was.
+ *
+ * Each call to next() runs the search until it reaches the next solution, runs out of
+ * solutions, or runs out of the budget it was given (see 'SearchLimits.h'), in which
+ * case it is suspended and the next call resumes it. A long enumeration can therefore
+ * be streamed to a consumer lazily, or time-sliced with other work on one thread.
+ *
+ * The iterator holds its whole state in fixed-size members and is trivially copyable,
+ * so a snapshot of a search is simply a copy of the iterator: the copy can be resumed
+ * later (or elsewhere, or several times) and yields the same solutions the original
+ * would have from that point on.
+ *
+ * Each node places a forced digit if there is one (a cell with a single candidate, or a
+ * digit with a single place in some unit) and otherwise branches on the cell with the
+ * fewest candidates, trying its digits in ascending order. Used digits are tracked with
+ * the same GridCandidates masks as the backtracking engine (see 'Candidates.h').
+ */
+
+#ifndef SOLUTION_ITERATOR_H
+#define SOLUTION_ITERATOR_H
+
+//Protected includes (for argument and return types)
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+
+//Header includes (for member and argument types)
+#include "GridGeometry.h"
+#include "Candidates.h"
+#include "SearchStats.h"
+#include "SearchLimits.h"
+
+using namespace std;
+
+template<int BOX>
+class SolutionIterator {
+
+public:
+
+	typedef GridGeometry<BOX> Geometry;
+	typedef typename Geometry::Mask Mask;
+
+	static constexpr int SIDE = Geometry::SIDE;
+	static constexpr int CELLS = Geometry::CELLS;
+
+	//What a call to next() stopped at
+	enum Status {
+		//A solution, which getSolution copies out
+		FOUND,
+		//The end of the search; there are no further solutions
+		FINISHED,
+		//The end of the call's budget; calling next() again resumes the search
+		SUSPENDED
+	};
+
+private:
+
+	//One level of the search: the cell it branched on, the digit placed there (zero
+	//before the first), and the digits still to be tried
+	struct Frame {
+		uint16_t cell;
+		uint8_t digit;
+		Mask remaining;
+	};
+
+	//Whether the next step expands the node at the top of the stack, or moves the top
+	//frame on to its next digit
+	enum Phase {
+		EXPAND,
+		ADVANCE,
+		DONE
+	};
+
+	//The working board; zero denotes an unsolved value
+	uint8_t cells[CELLS];
+	GridCandidates<BOX> used;
+	Frame frames[CELLS];
+	int depth;
+	Phase phase;
+	long solutions;
+	SearchStats stats;
+
+	void assign(int index, int digit);
+	void unassign(int index, int digit);
+	bool expand();
+
+public:
+
+	SolutionIterator();
+
+	bool load(const vector<int>& state);
+	bool load(const uint8_t* state);
+	Status next(const SearchLimits& limits = SearchLimits());
+	void getSolution(vector<int>& state) const;
+	void getSolution(uint8_t* state) const;
+	bool isFinished() const;
+	long getSolutions() const;
+	int getDepth() const;
+	const SearchStats& getStats() const;
+
+};
+
+/*** Public interface implementation ***/
+
+//Public constructor. Starts out with an empty board.
+template<int BOX>
+SolutionIterator<BOX>::SolutionIterator() {
+	vector<int> empty;
+	this->load(empty);
+}
+
+/**
+ * Copies a game state (unsolved values denoted by -1, missing trailing values treated
+ * as unsolved) into the working board and starts a new search of it. Returns false if
+ * the state holds a value outside 1 to SIDE or places a digit twice within a unit, in
+ * which case the search is already finished.
+ *
+ * @param 	state 	A reference to a vector describing a possible game state
+ */
+template<int BOX>
+bool SolutionIterator<BOX>::load(const vector<int>& state) {
+	uint8_t bytes[CELLS];
+	bool valid = true;
+	for(int i = 0; i < CELLS; i++) {
+		int value = (i < state.size()) ? state[i] : -1;
+		if(value != -1 && (value < 1 || value > SIDE)) {
+			valid = false;
+			value = -1;
+		}
+		bytes[i] = (value == -1) ? 0 : (uint8_t)value;
+	}
+	return this->load(bytes) && valid;
+}
+
+/**
+ * Copies a game state held as one byte per cell (zero for an unsolved value, as in a
+ * Board) into the working board and starts a new search of it; see above.
+ *
+ * @param 	state 	The first of CELLS bytes describing a possible game state
+ */
+template<int BOX>
+bool SolutionIterator<BOX>::load(const uint8_t* state) {
+	bool valid = this->used.load(state);
+	for(int i = 0; i < CELLS; i++) {
+		this->cells[i] = state[i];
+	}
+	this->stats.reset();
+	this->solutions = 0;
+	this->depth = 0;
+	this->phase = valid ? EXPAND : DONE;
+	return valid;
+}
+
+/**
+ * Runs the search on to its next solution, leaving the solution in the working board.
+ * Returns SUSPENDED if the limits run out first (they are tested between nodes, and
+ * the node budget counts only the nodes of this call), and FINISHED once every
+ * solution has been found.
+ *
+ * @param 	limits 	The budget of this call
+ */
+template<int BOX>
+typename SolutionIterator<BOX>::Status SolutionIterator<BOX>::next(const SearchLimits& limits) {
+	long nodes = 0;
+	long next_check = limits.getNextCheck(0);
+	while(this->phase != DONE) {
+		if(this->phase == ADVANCE) {
+			if(this->depth == 0) {
+				this->phase = DONE;
+				break;
+			}
+			//Take back the top frame's digit, and place its next one (if any)
+			Frame& frame = this->frames[this->depth - 1];
+			if(frame.digit != 0) {
+				this->unassign(frame.cell, frame.digit);
+				SEARCH_STATS_ONLY(this->stats.backtracks++);
+			}
+			if(frame.remaining == 0) {
+				this->depth--;
+				continue;
+			}
+			frame.digit = (uint8_t)(__builtin_ctz(frame.remaining) + 1);
+			frame.remaining &= frame.remaining - 1;
+			SEARCH_STATS_ONLY(this->stats.candidates_tried++);
+			this->assign(frame.cell, frame.digit);
+			this->phase = EXPAND;
+			continue;
+		}
+		if(nodes >= next_check) {
+			if(limits.isExhausted(nodes)) {
+				return SUSPENDED;
+			}
+			next_check = limits.getNextCheck(nodes);
+		}
+		nodes++;
+		this->stats.nodes++;
+		SEARCH_STATS_ONLY(this->stats.recordDepth(this->depth));
+		//A full board is a solution; a dead end is simply backed out of
+		bool full = this->expand();
+		this->phase = ADVANCE;
+		if(full) {
+			this->solutions++;
+			return FOUND;
+		}
+	}
+	return FINISHED;
+}
+
+//Copies the working board (the latest solution, after next() returns FOUND) into the
+//given vector (unsolved values denoted by -1)
+template<int BOX>
+void SolutionIterator<BOX>::getSolution(vector<int>& state) const {
+	state.resize(CELLS);
+	for(int i = 0; i < CELLS; i++) {
+		state[i] = (this->cells[i] == 0) ? -1 : this->cells[i];
+	}
+}
+
+//Copies the working board into an array of CELLS bytes (unsolved values denoted by zero)
+template<int BOX>
+void SolutionIterator<BOX>::getSolution(uint8_t* state) const {
+	for(int i = 0; i < CELLS; i++) {
+		state[i] = this->cells[i];
+	}
+}
+
+//Returns whether every solution has been found
+template<int BOX>
+bool SolutionIterator<BOX>::isFinished() const {
+	return this->phase == DONE;
+}
+
+//Returns the number of solutions found so far
+template<int BOX>
+long SolutionIterator<BOX>::getSolutions() const {
+	return this->solutions;
+}
+
+//Returns the number of frames on the stack
+template<int BOX>
+int SolutionIterator<BOX>::getDepth() const {
+	return this->depth;
+}
+
+//Returns the counters collected since the search was loaded, over every call to next()
+template<int BOX>
+const SearchStats& SolutionIterator<BOX>::getStats() const {
+	return this->stats;
+}
+
+/*** Private method implementations ***/
+
+template<int BOX>
+inline void SolutionIterator<BOX>::assign(int index, int digit) {
+	this->cells[index] = (uint8_t)digit;
+	this->used.place(index, digit);
+}
+
+template<int BOX>
+inline void SolutionIterator<BOX>::unassign(int index, int digit) {
+	this->cells[index] = 0;
+	this->used.remove(index, digit);
+}
+
+/**
+ * Expands the node described by the working board: pushes a frame for a forced digit,
+ * or for the cell with the fewest candidates, holding the digits to try there. Pushes
+ * nothing at a dead end. Returns true if the board is full (a solution).
+ */
+template<int BOX>
+bool SolutionIterator<BOX>::expand() {
+	const typename Geometry::Tables& tables = Geometry::TABLES;
+	//Find the empty cell with the fewest candidates
+	int best = -1;
+	int best_count = SIDE + 1;
+	for(int i = 0; i < CELLS; i++) {
+		if(this->cells[i] != 0) {
+			continue;
+		}
+		int count = __builtin_popcount(this->used.get(i));
+		if(count < best_count) {
+			best = i;
+			best_count = count;
+			if(count <= 1) {
+				break;
+			}
+		}
+	}
+	if(best == -1) {
+		return true;
+	}
+	if(best_count == 0) {
+		return false;
+	}
+	Frame& frame = this->frames[this->depth];
+	frame.cell = (uint16_t)best;
+	frame.digit = 0;
+	frame.remaining = this->used.get(best);
+	if(best_count == 1) {
+		this->stats.naked_singles++;
+		this->depth++;
+		return false;
+	}
+	//Look for a digit with a single place (or none) left in some unit
+	for(int unit = 0; unit < Geometry::UNITS; unit++) {
+		Mask once = 0;
+		Mask twice = 0;
+		for(int k = 0; k < SIDE; k++) {
+			int index = tables.units[unit][k];
+			if(this->cells[index] == 0) {
+				Mask candidates = this->used.get(index);
+				twice |= once & candidates;
+				once |= candidates;
+			}
+		}
+		Mask missing = Geometry::ALL_DIGITS & ~this->used.getUnitUsed(unit);
+		if(missing & ~once) {
+			//A digit the unit still needs fits nowhere in it
+			return false;
+		}
+		Mask single = once & ~twice;
+		if(single) {
+			Mask bit = single & (~single + 1);
+			for(int k = 0; k < SIDE; k++) {
+				int index = tables.units[unit][k];
+				if(this->cells[index] == 0 && (this->used.get(index) & bit)) {
+					this->stats.hidden_singles++;
+					frame.cell = (uint16_t)index;
+					frame.remaining = bit;
+					this->depth++;
+					return false;
+				}
+			}
+		}
+	}
+	SEARCH_STATS_ONLY(this->stats.branches++);
+	this->depth++;
+	return false;
+}
+
+static_assert(is_trivially_copyable<SolutionIterator<3> >::value, "a SolutionIterator is snapshotted by copying it");
+
+#endif
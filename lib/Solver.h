@@ -0,0 +1,139 @@
+/**
+ * @file Solver.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the Solver interface shared by every search engine. A Sudoku object hands
+ * its current state to whichever engine its strategy selects and reads the solution
+ * back out, so engines can be swapped (or run side by side to cross-check one another)
+ * without changing any calling code.
+ *
+ * Every engine honours the SearchLimits set on it: once a search runs out of budget it
+ * stops where it is, and isExhausted() tells its caller that the result is incomplete.
+ * The budget and counters live in BudgetedSearch, which engines for grids of other
+ * sizes (see 'Backtracker.h') share without the 9x9 Board interface.
+ */
+
+#ifndef SOLVER_H
+#define SOLVER_H
+
+//Protected includes (for argument and return types)
+#include <vector>
+#include <cstddef>
+
+//Header includes (for argument and member types)
+#include "SearchStats.h"
+#include "SearchLimits.h"
+#include "Board.h"
+
+using namespace std;
+
+/**
+ * Receives each solution found while an engine enumerates the solutions of a board.
+ * The board is only valid for the duration of the call; returning false stops the
+ * enumeration.
+ */
+class SolutionCallback {
+
+public:
+
+	virtual ~SolutionCallback() {}
+
+	virtual bool onSolution(const int* board) = 0;
+
+};
+
+//The counters and budget of a search, shared by every engine whatever the size of the
+//grids it solves. Solver adds the interface of an engine for 9x9 boards.
+class BudgetedSearch {
+
+protected:
+
+	//Counters describing the most recent call to solve()
+	SearchStats stats;
+	//The budget of each search, the node count at which it is next tested, and whether
+	//the most recent search ran out of it
+	SearchLimits limits;
+	long next_check;
+	bool exhausted;
+
+	//Called by an engine as it starts a search, once its counters have been reset
+	void startBudget() {
+		this->exhausted = false;
+		this->next_check = this->limits.getNextCheck(this->stats.nodes);
+	}
+
+	//Called by an engine at every node, after counting it; returns true once the search
+	//should stop. Costs a single comparison except at a checkpoint.
+	bool isOverBudget() {
+		if(this->stats.nodes < this->next_check) {
+			return false;
+		}
+		if(this->exhausted || this->limits.isExhausted(this->stats.nodes)) {
+			this->exhausted = true;
+			return true;
+		}
+		this->next_check = this->limits.getNextCheck(this->stats.nodes);
+		return false;
+	}
+
+public:
+
+	BudgetedSearch() : next_check(LONG_MAX), exhausted(false) {
+	}
+
+	const SearchStats& getStats() const {
+		return this->stats;
+	}
+
+	//Public getter/setter for the limits member; the limits apply to every later search
+	const SearchLimits& getLimits() const {
+		return this->limits;
+	}
+
+	void setLimits(const SearchLimits& limits) {
+		this->limits = limits;
+	}
+
+	//Returns whether the most recent search stopped because it ran out of budget (in
+	//which case its result, and its counters, cover only part of the search)
+	bool isExhausted() const {
+		return this->exhausted;
+	}
+
+};
+
+class Solver : public BudgetedSearch {
+
+public:
+
+	virtual ~Solver() {}
+
+	//Copies a board into the engine. Returns false if the board already contains a
+	//conflict (or an invalid cell), in which case it cannot be solved.
+	virtual bool load(const Board& board) = 0;
+	//Searches for a solution to the loaded state, returning whether one was found
+	virtual bool solve() = 0;
+	//Copies the engine's board (the solution, after a successful solve) into a Board
+	virtual void getBoard(Board& board) const = 0;
+	//Counts the solutions of the loaded state, stopping once 'limit' have been found (a
+	//limit of zero means no limit) or the callback (if any) returns false
+	virtual long countSolutions(long limit, SolutionCallback* callback = NULL) = 0;
+
+	//Forms of load and getBoard taking a game state as a vector (unsolved values
+	//denoted by -1)
+	bool load(const vector<int>& state) {
+		Board board;
+		board.fromVector(state);
+		return this->load(board);
+	}
+
+	void getBoard(vector<int>& state) const {
+		Board board;
+		this->getBoard(board);
+		board.toVector(state);
+	}
+
+};
+
+#endif
@@ -0,0 +1,441 @@
+/**
+ * @file SolverServer.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the public interface and private methods of the
+ * SolverServer class. For details about this class, see 'SolverServer.h'.
+ */
+
+//Protected includes
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <condition_variable>
+#include <list>
+#include <string>
+#include <thread>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+//Header includes
+#include "SolverServer.h"
+#include "BatchSolver.h"
+
+using namespace std;
+
+//The state shared by the requests of one connection
+struct SolverServer::Connection {
+
+	int output;
+	//Held while a response is written; set once the output can no longer be written
+	mutex write_lock;
+	bool broken;
+	//Requests read but not yet answered
+	mutex pending_lock;
+	condition_variable answered;
+	long pending;
+
+	Connection(int output) {
+		this->output = output;
+		this->broken = false;
+		this->pending = 0;
+	}
+
+};
+
+//A request waiting to be answered. Pooled by the server, so its strings keep their
+//capacity from one request to the next.
+struct SolverServer::Request {
+
+	Connection* connection;
+	string id;
+	string puzzle;
+	string response;
+	SearchLimits limits;
+
+	//Sizes the strings for any typical request, whichever one the object carries next
+	Request() {
+		this->connection = NULL;
+		this->id.reserve(ID_CAPACITY);
+		this->puzzle.reserve(81);
+		this->response.reserve(ID_CAPACITY + 128);
+	}
+
+	static const size_t ID_CAPACITY = 64;
+
+};
+
+//Kept to this file, so the name can't collide with another translation unit's
+namespace {
+
+//A connection accepted by listen(), served on a thread of its own
+struct Client {
+
+	thread runner;
+	int socket;
+	atomic<bool> finished;
+
+	Client(int socket) : finished(false) {
+		this->socket = socket;
+	}
+
+};
+
+}
+
+/*** Public interface implementation ***/
+
+/**
+ * Public constructor. Starts the worker threads, each with its own copy of the given
+ * Sudoku object.
+ *
+ * @param 	configuration 	A Sudoku object whose strategy and search options are used
+ * @param 	threads 		The number of worker threads (zero for one per hardware thread)
+ */
+SolverServer::SolverServer(const Sudoku& configuration, int threads) :
+		request_pool((threads > 0) ? threads : ThreadPool::getDefaultSize()), requests(0), listener(-1), stopping(false) {
+	this->timeout = 0;
+	this->max_nodes = 0;
+	this->pool = new ThreadPool((threads > 0) ? threads : ThreadPool::getDefaultSize());
+	this->solvers.assign(this->pool->size(), configuration);
+}
+
+//Destructor. Finishes any outstanding requests, then stops the workers.
+SolverServer::~SolverServer() {
+	delete this->pool;
+}
+
+//Returns the number of worker threads
+int SolverServer::getThreads() const {
+	return this->pool->size();
+}
+
+//Returns the number of requests answered so far, error responses included
+long SolverServer::getRequests() const {
+	return this->requests;
+}
+
+//Public getter for the timeout member
+double SolverServer::getTimeout() const {
+	return this->timeout;
+}
+
+/**
+ * Sets the latency cap of each request: a search still running this many seconds after
+ * its request was read is abandoned. Applies to requests read after the call.
+ *
+ * @param 	seconds 	The timeout (zero for none)
+ */
+void SolverServer::setTimeout(double seconds) {
+	this->timeout = (seconds > 0) ? seconds : 0;
+}
+
+//Public getter for the max_nodes member
+long SolverServer::getMaxNodes() const {
+	return this->max_nodes;
+}
+
+//Public setter for the max_nodes member; the node budget of each request (zero for none)
+void SolverServer::setMaxNodes(long nodes) {
+	this->max_nodes = (nodes > 0) ? nodes : 0;
+}
+
+//Returns the number of request objects the server has created; after warming up, this
+//stays at the most requests that have been waiting at once
+size_t SolverServer::getPooledRequests() {
+	return this->request_pool.getCreated();
+}
+
+/**
+ * Answers the requests read from one file descriptor, writing the responses to another
+ * (which may be the same descriptor, as for a socket). Returns once the input is
+ * exhausted and every request read has been answered, giving the number of requests.
+ *
+ * @param 	input 	The descriptor requests are read from
+ * @param 	output 	The descriptor responses are written to
+ */
+long SolverServer::serve(int input, int output) {
+	Connection connection(output);
+	char buffer[65536];
+	string line;
+	string id;
+	bool overlong = false;
+	bool exhausted = false;
+	long sequence = 0;
+	while(!exhausted) {
+		ssize_t count = read(input, buffer, sizeof(buffer));
+		if(count < 0 && errno == EINTR) {
+			continue;
+		}
+		exhausted = count <= 0;
+		const char* start = buffer;
+		const char* end = buffer + ((count > 0) ? count : 0);
+		while(start < end || (exhausted && (!line.empty() || overlong))) {
+			const char* newline = (const char*)memchr(start, '\n', end - start);
+			const char* stop = (newline != NULL) ? newline : end;
+			//A line too long to be a request is dropped as it arrives
+			if(!overlong) {
+				line.append(start, stop - start);
+				if(line.size() > MAX_REQUEST_SIZE) {
+					overlong = true;
+					line.clear();
+				}
+			}
+			start = (newline != NULL) ? newline + 1 : end;
+			if(newline == NULL && !exhausted) {
+				break;
+			}
+			if(!line.empty() && line[line.size() - 1] == '\r') {
+				line.erase(line.size() - 1);
+			}
+			if(overlong) {
+				sequence++;
+				respond(&connection, to_string(sequence) + " error request too long\n");
+				this->requests++;
+			} else if(!BatchSolver::isSkippedLine(line)) {
+				sequence++;
+				const char* puzzle = NULL;
+				size_t length = 0;
+				parseRequest(line.data(), line.size(), sequence, id, puzzle, length);
+				this->submit(&connection, id, puzzle, length);
+			}
+			line.clear();
+			overlong = false;
+		}
+	}
+	//Requests still being solved refer to the connection, so wait for every answer
+	unique_lock<mutex> guard(connection.pending_lock);
+	while(connection.pending > 0) {
+		connection.answered.wait(guard);
+	}
+	return sequence;
+}
+
+/**
+ * Listens on a Unix-domain socket, serving each connection on a thread of its own,
+ * until stop() is called. Any file already at the path is replaced, and the socket is
+ * removed again on return. Returns false if the socket could not be set up.
+ *
+ * @param 	path 	The filesystem path of the socket
+ */
+bool SolverServer::listen(const string& path) {
+	sockaddr_un address;
+	memset(&address, 0, sizeof(address));
+	if(path.empty() || path.size() >= sizeof(address.sun_path)) {
+		return false;
+	}
+	address.sun_family = AF_UNIX;
+	memcpy(address.sun_path, path.data(), path.size());
+	int socket_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if(socket_fd < 0) {
+		return false;
+	}
+	unlink(path.c_str());
+	if(bind(socket_fd, (sockaddr*)&address, sizeof(address)) < 0 || ::listen(socket_fd, SOMAXCONN) < 0) {
+		close(socket_fd);
+		return false;
+	}
+	//Set before stopping is checked, so stop() either sees the socket or is seen here
+	this->listener = socket_fd;
+	list<Client*> clients;
+	while(!this->stopping) {
+		int client_fd = accept(socket_fd, NULL, NULL);
+		if(client_fd < 0) {
+			if(errno == EINTR || errno == ECONNABORTED) {
+				continue;
+			}
+			break;
+		}
+		//Reap the threads of connections that have closed
+		for(list<Client*>::iterator it = clients.begin(); it != clients.end();) {
+			if((*it)->finished) {
+				(*it)->runner.join();
+				close((*it)->socket);
+				delete *it;
+				it = clients.erase(it);
+			} else {
+				it++;
+			}
+		}
+		Client* client = new Client(client_fd);
+		client->runner = thread([this, client]() {
+			this->serve(client->socket, client->socket);
+			//Every response is written; the client sees the end of the stream
+			shutdown(client->socket, SHUT_WR);
+			client->finished = true;
+		});
+		clients.push_back(client);
+	}
+	this->listener = -1;
+	close(socket_fd);
+	unlink(path.c_str());
+	//Stop reading from the open connections; what they have sent is still answered
+	for(list<Client*>::iterator it = clients.begin(); it != clients.end(); it++) {
+		shutdown((*it)->socket, SHUT_RD);
+	}
+	for(list<Client*>::iterator it = clients.begin(); it != clients.end(); it++) {
+		(*it)->runner.join();
+		close((*it)->socket);
+		delete *it;
+	}
+	return true;
+}
+
+//Makes listen() return, from any thread (or from a signal handler, since it touches
+//only lock-free atomics and calls shutdown(), which is async-signal-safe)
+void SolverServer::stop() {
+	static_assert(ATOMIC_BOOL_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2, "stop() must be lock-free");
+	this->stopping = true;
+	int socket_fd = this->listener;
+	if(socket_fd >= 0) {
+		shutdown(socket_fd, SHUT_RDWR);
+	}
+}
+
+/*** Static class method implementations ***/
+
+/**
+ * Splits a request line into its ID and its puzzle. A line holding a single field is
+ * taken to be a puzzle, and gets its sequence number as its ID. Returns false if the
+ * line holds nothing but whitespace.
+ *
+ * @param 	line 			The first character of the request line
+ * @param 	length 			The length of the line, without its line terminator
+ * @param 	sequence 		The position of the request on its connection, counting from 1
+ * @param 	id 				Receives the ID
+ * @param 	puzzle 			Receives the first character of the puzzle, within the line
+ * @param 	puzzle_length 	Receives the length of the puzzle
+ */
+bool SolverServer::parseRequest(const char* line, size_t length, long sequence, string& id,
+								const char*& puzzle, size_t& puzzle_length) {
+	size_t first = 0;
+	while(first < length && isspace((unsigned char)line[first])) {
+		first++;
+	}
+	while(length > first && isspace((unsigned char)line[length - 1])) {
+		length--;
+	}
+	if(first == length) {
+		return false;
+	}
+	size_t split = first;
+	while(split < length && !isspace((unsigned char)line[split])) {
+		split++;
+	}
+	size_t rest = split;
+	while(rest < length && isspace((unsigned char)line[rest])) {
+		rest++;
+	}
+	if(rest == length) {
+		id = to_string(sequence);
+		puzzle = line + first;
+		puzzle_length = length - first;
+	} else {
+		id.assign(line + first, split - first);
+		puzzle = line + rest;
+		puzzle_length = length - rest;
+	}
+	return true;
+}
+
+/**
+ * Solves the puzzle of one request, writing its response line.
+ *
+ * @param 	sudoku 		The Sudoku object used to solve the puzzle
+ * @param 	id 			The ID of the request
+ * @param 	puzzle 		The first character of the puzzle
+ * @param 	length 		The length of the puzzle
+ * @param 	response 	Receives the response line, with its line terminator
+ * @param 	limits 		The budget of the search
+ */
+void SolverServer::answer(Sudoku& sudoku, const string& id, const char* puzzle, size_t length, string& response,
+						  const SearchLimits& limits) {
+	response = id;
+	response += ' ';
+	if(!BatchSolver::isPuzzleLine(puzzle, length)) {
+		response += "error malformed puzzle (expected 81 characters, each a digit or '.')\n";
+		return;
+	}
+	sudoku.setState(puzzle, length);
+	Sudoku::Result result = sudoku.solve(limits);
+	if(result == Sudoku::SOLVED) {
+		const Board& board = sudoku.getCurrentCells();
+		for(int i = 0; i < 81; i++) {
+			response += (char)('0' + board.get(i));
+		}
+	} else if(result == Sudoku::BUDGET_EXHAUSTED) {
+		response += "exhausted";
+	} else {
+		response += "unsolvable";
+	}
+	response += '\n';
+}
+
+/*** Private method implementations ***/
+
+/**
+ * Queues a request to be answered by a worker, first waiting for room if the connection
+ * already has too many requests waiting.
+ *
+ * @param 	connection 	The connection the request arrived on
+ * @param 	id 			The ID of the request
+ * @param 	puzzle 		The first character of the puzzle
+ * @param 	length 		The length of the puzzle
+ */
+void SolverServer::submit(Connection* connection, const string& id, const char* puzzle, size_t length) {
+	{
+		unique_lock<mutex> guard(connection->pending_lock);
+		while(connection->pending >= MAX_PENDING) {
+			connection->answered.wait(guard);
+		}
+		connection->pending++;
+	}
+	//The latency cap runs from when the request was read, time spent queued included
+	Request* request = this->request_pool.acquire();
+	request->connection = connection;
+	request->id = id;
+	request->puzzle.assign(puzzle, length);
+	request->limits = SearchLimits();
+	if(this->timeout > 0) {
+		request->limits.setTimeout(this->timeout);
+	}
+	request->limits.setMaxNodes(this->max_nodes);
+	//Capturing only two pointers, the task fits inside the function object
+	this->pool->submit([this, request](int worker) {
+		Connection* connection = request->connection;
+		answer(this->solvers[worker], request->id, request->puzzle.data(), request->puzzle.size(),
+			   request->response, request->limits);
+		respond(connection, request->response);
+		this->request_pool.release(request, worker);
+		this->requests++;
+		lock_guard<mutex> guard(connection->pending_lock);
+		connection->pending--;
+		connection->answered.notify_all();
+	});
+}
+
+/**
+ * Writes a response line to a connection, whole, even if other responses are being
+ * written at the same time. Once a write fails (the peer has gone away), the remaining
+ * responses of the connection are dropped.
+ *
+ * @param 	connection 	The connection to respond on
+ * @param 	response 	The response line
+ */
+void SolverServer::respond(Connection* connection, const string& response) {
+	lock_guard<mutex> guard(connection->write_lock);
+	size_t written = 0;
+	while(!connection->broken && written < response.size()) {
+		ssize_t count = write(connection->output, response.data() + written, response.size() - written);
+		if(count < 0 && errno == EINTR) {
+			continue;
+		}
+		if(count <= 0) {
+			connection->broken = true;
+		} else {
+			written += count;
+		}
+	}
+}
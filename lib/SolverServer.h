@@ -0,0 +1,116 @@
+/**
+ * @file SolverServer.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the SolverServer class, a long-lived solver that answers a stream of
+ * requests, so that a caller solving puzzles one at a time pays for process startup
+ * once rather than per puzzle. Requests are read from a pair of file descriptors (such
+ * as standard input and output) or from the connections to a Unix-domain socket.
+ *
+ * Each request is one line: an ID (any run of non-whitespace characters), whitespace,
+ * and a puzzle in the one-line format. A line holding only a puzzle is given its line
+ * number on the connection (counting requests from 1) as its ID. Each request gets one
+ * response line, starting with its ID:
+ *
+ *     <id> <81-digit solution>
+ *     <id> unsolvable
+ *     <id> exhausted
+ *     <id> error <message>
+ *
+ * Requests are pipelined: the reading thread hands each one to a ThreadPool and goes
+ * straight back to reading, and each response is written as soon as its puzzle is
+ * solved, so with several threads responses can come back out of order (the ID says
+ * which request each one answers). Blank lines and '#' comments are ignored. A request
+ * that can't be answered (a malformed puzzle, or a line too long to be read, which is
+ * answered under its line number) gets an error response, and the server carries on.
+ *
+ * Each request can be given a latency cap (a timeout, counted from when the request was
+ * read) and a node budget, so that no single adversarial puzzle can hold a worker for
+ * long; a request whose search runs out of either is answered "exhausted".
+ *
+ * Requests are held in pooled objects whose buffers are reused from one request to the
+ * next, and each worker solves with a Sudoku object of its own, so once the server has
+ * warmed up, answering a request makes no heap allocations (unless a SolutionCache is
+ * in use).
+ */
+
+#ifndef SOLVER_SERVER_H
+#define SOLVER_SERVER_H
+
+//Protected includes (for argument, return, and member types)
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//Header includes (for member types)
+#include "Sudoku.h"
+#include "ThreadPool.h"
+#include "ObjectPool.h"
+
+using namespace std;
+
+class SolverServer {
+
+private:
+
+	//The state shared by the requests of one connection, and a request being answered
+	struct Connection;
+	struct Request;
+
+	//Per-worker solver state, copied from the configuration given to the constructor
+	vector<Sudoku> solvers;
+	ThreadPool* pool;
+	//Requests are acquired by each connection's reader, and released onto the shelf of
+	//the worker that answered them
+	ObjectPool<Request> request_pool;
+	//Requests answered so far, over every connection
+	atomic<long> requests;
+	//The listening socket while listen() runs (-1 otherwise), and whether to stop
+	atomic<int> listener;
+	atomic<bool> stopping;
+	//The budget of each request: seconds from when it is read (zero for no timeout), and
+	//search nodes (zero for no limit)
+	double timeout;
+	long max_nodes;
+
+	void submit(Connection* connection, const string& id, const char* puzzle, size_t length);
+	static void respond(Connection* connection, const string& response);
+
+	//Non-copyable
+	SolverServer(const SolverServer&);
+	SolverServer& operator=(const SolverServer&);
+
+public:
+
+	//Longest request line accepted, in bytes
+	static const size_t MAX_REQUEST_SIZE = 1024;
+	//Most requests of one connection waiting to be answered before reading pauses
+	static const long MAX_PENDING = 1024;
+
+	SolverServer(const Sudoku& configuration, int threads = 1);
+	~SolverServer();
+
+	int getThreads() const;
+	long getRequests() const;
+	size_t getPooledRequests();
+	double getTimeout() const;
+	void setTimeout(double seconds);
+	long getMaxNodes() const;
+	void setMaxNodes(long nodes);
+
+	long serve(int input, int output);
+	bool listen(const string& path);
+	void stop();
+
+	//Static helper functions
+	static bool parseRequest(const char* line, size_t length, long sequence, string& id,
+							 const char*& puzzle, size_t& puzzle_length);
+	static void answer(Sudoku& sudoku, const string& id, const char* puzzle, size_t length, string& response,
+					   const SearchLimits& limits = SearchLimits());
+
+};
+
+#endif
@@ -14,11 +14,19 @@
 #include <cstdlib>
 #include <algorithm>
 
-//Header include
+//Header includes
 #include "Sudoku.h"
+#include "ThreadPool.h"
+#include "ParallelSearch.h"
+#include "BoardKernels.h"
+#include "GridGeometry.h"
+#include "BoardTransform.h"
 
 using namespace std;
 
+//The shape of the grid handled by this class
+typedef GridGeometry<3> Geometry;
+
 //Initialize the const DIGITS vector
 const int digits[ ] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
 const vector<int> Sudoku::DIGITS(digits, digits + 9);
@@ -27,54 +35,217 @@ const vector<int> Sudoku::DIGITS(digits, digits + 9);
 
 /**
  * Public constructor. Takes a reference to a string describing a possible unsolved Sudoku
- * game, translates this string into a vector of puzzle values, and initializes the object's
+ * game, translates this string into a compact board of puzzle values, and initializes the object's
  * starting_board and current_board members.
  *
+ * @param 	state 		A reference to a Sudoku game string
+ * @param 	strategy 	The search engine to be used by Sudoku::solve
+ */
+Sudoku::Sudoku(const string& state_str, Strategy strategy) {
+	this->strategy = strategy;
+	this->threads = 1;
+	this->cache = NULL;
+	this->triaging = true;
+	this->editor_stale = true;
+	this->setState(state_str);
+}
+
+/**
+ * Replaces the game held by this object, resetting its starting_board and current_board
+ * members. Lets one object (and its search engines) be reused across many games.
+ * Unsolved values may be denoted by either '.' or '0'.
+ *
  * @param 	state 	A reference to a Sudoku game string
  */
-Sudoku::Sudoku(const string& state_str) {
-	//Parse the string to generate a vector of integers
-	for(int i = 0; i < state_str.size(); i++) {
-		char c = state_str[i];
-		string s(1, c);
-		//Unsolved values are denoted by a -1
-		this->starting_board.push_back((c == '.') ? -1 : atoi(s.c_str()));
-	}
+void Sudoku::setState(const string& state_str) {
+	this->setState(state_str.data(), state_str.size());
+}
+
+/**
+ * Replaces the game held by this object with one read from a run of characters (see
+ * above). The characters are parsed where they lie, so a puzzle can be loaded straight
+ * out of a larger buffer, such as a mapped corpus file.
+ *
+ * @param 	state 	The first character of a Sudoku game string
+ * @param 	length 	The number of characters in the game string
+ */
+void Sudoku::setState(const char* state, size_t length) {
+	//Each character is translated by a single table lookup
+	this->starting_board.parse(state, length);
 	//Set the initial state of the current_board
-	//this->current_board(this->starting_board);
 	this->current_board = this->starting_board;
+	this->editor_stale = true;
 }
 
-//Public getter for the starting_board member
+/**
+ * Replaces the game held by this object with a board that has already been decoded
+ * (from a binary corpus, for example), skipping the text format altogether.
+ *
+ * @param 	state 	A reference to a board
+ */
+void Sudoku::setState(const Board& state) {
+	this->starting_board = state;
+	this->current_board = state;
+	this->editor_stale = true;
+}
+
+//Returns the starting_board member as a vector (unsolved values denoted by -1)
 vector<int> Sudoku::getStartingBoard() const {
+	vector<int> state;
+	this->starting_board.toVector(state);
+	return state;
+}
+
+//Returns the current_board member as a vector (unsolved values denoted by -1)
+vector<int> Sudoku::getCurrentBoard() const {
+	vector<int> state;
+	this->current_board.toVector(state);
+	return state;
+}
+
+//Public getter for the starting_board member
+const Board& Sudoku::getStartingCells() const {
 	return this->starting_board;
 }
 
 //Public getter for the current_board member
-vector<int> Sudoku::getCurrentBoard() const {
+const Board& Sudoku::getCurrentCells() const {
 	return this->current_board;
 }
 
+//Public getter for the strategy member
+Sudoku::Strategy Sudoku::getStrategy() const {
+	return this->strategy;
+}
+
+//Public setter for the strategy member; takes effect on the next call to solve()
+void Sudoku::setStrategy(Strategy strategy) {
+	this->strategy = strategy;
+}
+
+//Returns whether the backtracking engine runs its constraint propagation stage
+bool Sudoku::getPropagation() const {
+	return this->backtracker.getPropagation();
+}
+
+/**
+ * Enables or disables the constraint propagation stage (naked singles, hidden singles,
+ * and locked candidates) which the backtracking engine runs before every branch.
+ *
+ * @param 	enabled 	Whether propagation should run
+ */
+void Sudoku::setPropagation(bool enabled) {
+	this->backtracker.setPropagation(enabled);
+}
+
+//Returns the heuristic the backtracking engine uses to choose which cell to branch on
+Backtracker::CellOrder Sudoku::getCellOrder() const {
+	return this->backtracker.getCellOrder();
+}
+
+/**
+ * Selects the heuristic the backtracking engine uses to choose which cell to branch on:
+ * the first empty cell in row-major order, or the cell with the fewest candidates.
+ *
+ * @param 	order 	The cell selection heuristic
+ */
+void Sudoku::setCellOrder(Backtracker::CellOrder order) {
+	this->backtracker.setCellOrder(order);
+}
+
+//Returns the heuristic the backtracking engine uses to order the digits it tries
+Backtracker::ValueOrder Sudoku::getValueOrder() const {
+	return this->backtracker.getValueOrder();
+}
+
+/**
+ * Selects the heuristic the backtracking engine uses to order the digits it tries at
+ * each cell: ascending, or least-constraining first.
+ *
+ * @param 	order 	The value ordering heuristic
+ */
+void Sudoku::setValueOrder(Backtracker::ValueOrder order) {
+	this->backtracker.setValueOrder(order);
+}
+
+//Public getter for the threads member
+int Sudoku::getThreads() const {
+	return this->threads;
+}
+
+/**
+ * Sets the number of threads used to search a single board. With more than one, the
+ * backtracking engine's search tree is split into subtrees that are searched in
+ * parallel (see 'ParallelSearch.h'); the worker threads are started by the first such
+ * search and kept for the ones after it.
+ *
+ * @param 	threads 	The number of threads (zero for one per hardware thread)
+ */
+void Sudoku::setThreads(int threads) {
+	this->threads = (threads > 0) ? threads : ThreadPool::getDefaultSize();
+}
+
+//Public getter for the cache member
+SolutionCache* Sudoku::getCache() const {
+	return this->cache;
+}
+
+/**
+ * Sets the cache consulted by solve(). The cache is not owned, and may be shared with
+ * other Sudoku objects (copies of this object share it too); it must outlive them.
+ *
+ * @param 	cache 	A solution cache, or NULL to always search
+ */
+void Sudoku::setCache(SolutionCache* cache) {
+	this->cache = cache;
+}
+
+//Public getter for the triaging member
+bool Sudoku::getTriage() const {
+	return this->triaging;
+}
+
+/**
+ * Enables or disables the triage stage (see 'Triage.h'), which solve() and the solution
+ * counting methods run on the board before any search, answering boards it rejects as
+ * unsolvable straight away. It is enabled by default.
+ *
+ * @param 	enabled 	Whether boards should be triaged
+ */
+void Sudoku::setTriage(bool enabled) {
+	this->triaging = enabled;
+}
+
+//Returns the triage result of the board last solved or counted (passed, if triage is off)
+const Triage& Sudoku::getTriageResult() const {
+	return this->triage;
+}
+
+//Returns the counters collected by the most recent search
+const SearchStats& Sudoku::getStats() const {
+	return this->stats;
+}
+
 /**
  * Prints the current board configuration to standard output, dividing each set
  * of nine digits into their own respective squares.
  */
 void Sudoku::printCurrentBoard() const {
 	cout << "\n";
-	for(int row = 0; row < DIGITS.size(); row++) {
+	for(int row = 0; row < Geometry::SIDE; row++) {
 		//Print a horizontal divider if necessary
-		if(row % 3 == 0) {
+		if(row % Geometry::BOX_SIZE == 0) {
 			cout << "+---+---+---+\n";
 		}
 		//Print the values of the row, separated into their associated squares
-		for(int col = 0; col < DIGITS.size(); col++) {
+		for(int col = 0; col < Geometry::SIDE; col++) {
 			//Print a vertical divider if necessary
-			if(col % 3 == 0) {
+			if(col % Geometry::BOX_SIZE == 0) {
 				cout << "|";
 			}
 			//Print the value, or indicate that it is yet to be solved for
-			int val = this->current_board[getIndexByCoordinate(row, col)];
-			if(val == -1 ) {
+			int val = this->current_board.get(getIndexByCoordinate(row, col));
+			if(val == 0) {
 				cout << ".";
 			} else {
 				cout << val;
@@ -85,20 +256,227 @@ void Sudoku::printCurrentBoard() const {
 	cout << "+---+---+---+\n";
 }
 
-//Public form of the isValid method; calls the private form, passing it the current state
+//Public form of the isValid method; calls the private form, passing it the current state.
+//Once the board is being edited, its conflicts are already known, and nothing is rescanned.
 bool Sudoku::isValid() const {
-	return isValid(this->getCurrentBoard());
+	if(!this->editor_stale) {
+		return this->editor.isValid();
+	}
+	return isValid(this->current_board);
 }
 
 //Public form of the isComplete method; calls the private form, passing it the current state
 bool Sudoku::isComplete() const {
-	return isComplete(this->getCurrentBoard());
+	if(!this->editor_stale) {
+		return this->editor.isComplete();
+	}
+	return isComplete(this->current_board);
+}
+
+/**
+ * Writes a digit into a cell of the current board, updating its conflicts and the
+ * candidates of its peers in O(peers). A digit conflicting with a peer is accepted (see
+ * getConflicts). Returns false, changing nothing, if the cell is one of the starting
+ * board's givens or the arguments are out of range.
+ *
+ * @param 	index 	The index of the cell
+ * @param 	digit 	The digit to write (1-9)
+ */
+bool Sudoku::setCell(int index, int digit) {
+	if(index < 0 || index >= 81 || digit < 1 || digit > 9 || !this->starting_board.isEmpty(index)) {
+		return false;
+	}
+	this->getEditor().set(index, digit);
+	this->current_board.set(index, (uint8_t)digit);
+	return true;
+}
+
+/**
+ * Empties a cell of the current board, as setCell does. Returns false if the cell is
+ * one of the starting board's givens or the index is out of range.
+ *
+ * @param 	index 	The index of the cell
+ */
+bool Sudoku::clearCell(int index) {
+	if(index < 0 || index >= 81 || !this->starting_board.isEmpty(index)) {
+		return false;
+	}
+	this->getEditor().set(index, 0);
+	this->current_board.clear(index);
+	return true;
+}
+
+//Undoes the most recent call to setCell or clearCell not yet undone. Returns false if
+//there is none (edits are forgotten once the board is replaced by setState or solve).
+bool Sudoku::undo() {
+	BoardEditor& editor = this->getEditor();
+	int index;
+	if(!editor.undo(index)) {
+		return false;
+	}
+	this->current_board.set(index, (uint8_t)editor.get(index));
+	return true;
+}
+
+/**
+ * Returns the digits that could be written into an empty cell of the current board
+ * without a conflict, in ascending order (none for a filled cell).
+ *
+ * @param 	index 	The index of the cell
+ */
+vector<int> Sudoku::getCandidates(int index) const {
+	vector<int> digits;
+	unsigned short mask = this->getEditor().getCandidates(index);
+	while(mask != 0) {
+		digits.push_back(Candidates::lowestDigit(mask));
+		mask &= mask - 1;
+	}
+	return digits;
+}
+
+//Returns the indices of the cells of the current board sharing a unit with another cell
+//holding the same digit, in ascending order
+vector<int> Sudoku::getConflicts() const {
+	vector<int> cells;
+	this->getEditor().getConflicts(cells);
+	return cells;
+}
+
+/**
+ * Returns whether the current board can still be completed. Conflicts and cells left
+ * without candidates are already known; after that, a board whose filled cells all agree
+ * with the solution found by the last check is solvable without searching again. Only
+ * otherwise is the board searched (from its current state, not from the start), and the
+ * solution found remembered for the next check.
+ */
+bool Sudoku::isSolvable() {
+	BoardEditor& editor = this->getEditor();
+	if(!editor.isValid() || editor.hasDeadCell()) {
+		return false;
+	}
+	if(editor.agreesWithSolution()) {
+		return true;
+	}
+	Solver& solver = this->getSolver();
+	solver.setLimits(SearchLimits());
+	this->stats.reset();
+	if(!solver.load(this->current_board)) {
+		return false;
+	}
+	bool solved = solver.solve();
+	this->stats = solver.getStats();
+	if(solved) {
+		Board solution;
+		solver.getBoard(solution);
+		editor.setSolution(solution);
+	}
+	return solved;
+}
+
+/**
+ * Suggests a digit for an empty cell of the current board. A digit forced by the
+ * candidates (a naked or hidden single) is preferred, as it can be explained; otherwise
+ * the most constrained cell is given its digit in the solution found by isSolvable.
+ * Returns false if the board is complete or can no longer be solved.
+ *
+ * @param 	index 	Receives the index of the cell
+ * @param 	digit 	Receives the digit
+ */
+bool Sudoku::getHint(int& index, int& digit) {
+	if(!this->isSolvable()) {
+		return false;
+	}
+	const BoardEditor& editor = this->getEditor();
+	if(editor.findSingle(index, digit)) {
+		return true;
+	}
+	index = editor.findMostConstrained();
+	if(index == -1) {
+		return false;
+	}
+	digit = editor.getSolution().get(index);
+	return true;
 }
 
-//Public form of the solve method
+/**
+ * Public form of the solve method. On success, current_board holds the solution. With a
+ * cache set, puzzles it accepts (see SolutionCache::isCacheable) are looked up by their
+ * canonical form first, and searched for only on a miss. Boards rejected by the triage
+ * stage (see setTriage) are unsolvable without any search or cache lookup.
+ */
 bool Sudoku::solve() {
-	//Shouldn't this modify the current_board member if the game is solved?
-	return solve(this->getCurrentBoard());
+	return this->solve(SearchLimits()) == SOLVED;
+}
+
+/**
+ * Form of the solve method which bounds the search by a deadline, a node budget, and/or
+ * a cancellation token. Returns BUDGET_EXHAUSTED if the search ran out of budget first,
+ * in which case current_board is left unchanged and the stats member holds the counters
+ * of the part of the search that was run. Exhausted searches are never cached.
+ *
+ * @param 	limits 	The budget of the search
+ */
+Sudoku::Result Sudoku::solve(const SearchLimits& limits) {
+	if(!this->passesTriage()) {
+		return UNSOLVABLE;
+	}
+	//Search from the board triage filled in; the singles it placed hold in every solution
+	Board given = this->current_board;
+	if(this->triaging) {
+		this->current_board = this->triage.getFilledBoard();
+	}
+	Result result;
+	if(this->cache != NULL && SolutionCache::isCacheable(this->current_board)) {
+		result = this->solveCached(limits);
+	} else {
+		result = this->solveUncached(limits);
+	}
+	if(result == SOLVED) {
+		this->editor_stale = true;
+	} else {
+		this->current_board = given;
+	}
+	return result;
+}
+
+/**
+ * Counts the solutions of the current board, stopping as soon as 'limit' have been
+ * found. Solutions are counted as the search reaches them; none are stored, and the
+ * current_board member is left unchanged.
+ *
+ * @param 	limit 	The number of solutions at which to stop counting (zero for no limit)
+ */
+long Sudoku::countSolutions(long limit) {
+	return this->enumerate(limit, NULL);
+}
+
+//Returns whether the current board has exactly one solution. The search stops as soon
+//as a second solution is found.
+bool Sudoku::hasUniqueSolution() {
+	return this->countSolutions(2) == 1;
+}
+
+/**
+ * Enumerates every solution of the current board, handing each to a callback as soon
+ * as it is found rather than storing them. Returns the number of solutions visited.
+ * When searching on several threads, calls to the callback are serialized but may
+ * arrive in any order.
+ *
+ * @param 	callback 	Receives each solution; returning false stops the enumeration
+ */
+long Sudoku::forEachSolution(SolutionCallback& callback) {
+	return this->enumerate(0, &callback);
+}
+
+/**
+ * Returns an iterator over the solutions of the current board, which finds them one at
+ * a time, as they are asked for (see 'SolutionIterator.h'). Unlike forEachSolution, the
+ * caller drives the search, and can suspend it, copy it, and resume it at will.
+ */
+SolutionIterator<3> Sudoku::getSolutionIterator() const {
+	SolutionIterator<3> solutions;
+	solutions.load(this->current_board.data());
+	return solutions;
 }
 
 /*** Static class method implementations ***/
@@ -110,7 +488,7 @@ bool Sudoku::solve() {
  * @param 	col 	The index of the desired column
  */
 int Sudoku::getIndexByCoordinate(int row, int col) {
-	return (row * DIGITS.size()) + col;
+	return (row * Geometry::SIDE) + col;
 }
 
 /**
@@ -120,11 +498,8 @@ int Sudoku::getIndexByCoordinate(int row, int col) {
  * @param 	row 	The index of the target row
  */
 vector<int> Sudoku::getIndicesOfRow(int row) {
-	vector<int> ret;
-	for(int i = 0; i < DIGITS.size(); i++) {
-		ret.push_back(getIndexByCoordinate(row, i));
-	}
-	return ret;
+	const uint8_t* unit = Board::TABLES.units[row];
+	return vector<int>(unit, unit + 9);
 }
 
 /**
@@ -134,11 +509,8 @@ vector<int> Sudoku::getIndicesOfRow(int row) {
  * @param 	col 	The index of the desired column
  */
 vector<int> Sudoku::getIndicesOfCol(int col) {
-	vector<int> ret;
-	for(int i = 0; i < DIGITS.size(); i++) {
-		ret.push_back(getIndexByCoordinate(i, col));
-	}
-	return ret;
+	const uint8_t* unit = Board::TABLES.units[9 + col];
+	return vector<int>(unit, unit + 9);
 }
 
 /**
@@ -148,19 +520,19 @@ vector<int> Sudoku::getIndicesOfCol(int col) {
  * @param 	square 	The index of the desired square (ordered left-to-right, top-to-bottom)
  */
 vector<int> Sudoku::getIndicesOfSquare(int square) {
-	vector<int> ret;
-	const int SQUARE_SIZE = 3;
-	int starting_row = (square / SQUARE_SIZE) * SQUARE_SIZE; //Integer division
-	int starting_col = (square % SQUARE_SIZE) * SQUARE_SIZE;
-	for(int row = 0; row < DIGITS.size(); row++) {
-		for(int col = 0; col < DIGITS.size(); col++) {
-			if(row >= starting_row && row < (starting_row + SQUARE_SIZE) &&
-			   col >= starting_col && col < (starting_col + SQUARE_SIZE)) {
-				ret.push_back(getIndexByCoordinate(row, col));
-			}
-		}
-	}
-	return ret;
+	const uint8_t* unit = Board::TABLES.units[18 + square];
+	return vector<int>(unit, unit + 9);
+}
+
+/**
+ * Returns the index of the 'square' containing the board item at the given row and
+ * column (squares are ordered left-to-right, top-to-bottom).
+ *
+ * @param 	row 	The index of the desired row
+ * @param 	col 	The index of the desired column
+ */
+int Sudoku::getSquareByCoordinate(int row, int col) {
+	return ((row / Geometry::BOX_SIZE) * Geometry::BOX_SIZE) + (col / Geometry::BOX_SIZE);
 }
 
 /**
@@ -171,19 +543,21 @@ vector<int> Sudoku::getIndicesOfSquare(int square) {
  * @param 	ints 	An integer vector of arbitrary length
  */
 bool Sudoku::containsDuplicateDigits(const vector<int>& ints) {
-	vector<int> digits(DIGITS);
+	//Bit (d - 1) is set once the digit d has been seen
+	unsigned short seen = 0;
 	for(int i = 0; i < ints.size(); i++) {
 		int value = ints[i];
 		if(value != -1) {
-			//Check whether a matching value still exists within the 'digits' vector
-			int digits_index = find(digits.begin(), digits.end(), value) - digits.begin();
-			if(digits_index < digits.size()) {
-				//Remove the value from 'digits' and continue
-				digits.erase(digits.begin() + digits_index);
-			} else {
+			if(value < 1 || value > 9) {
+				//Not a digit at all
+				return true;
+			}
+			unsigned short bit = Candidates::digitToMask(value);
+			if(seen & bit) {
 				//We've hit a duplicate
 				return true;
 			}
+			seen |= bit;
 		}
 	}
 	return false;
@@ -192,112 +566,200 @@ bool Sudoku::containsDuplicateDigits(const vector<int>& ints) {
 /*** Private method implementations ***/
 
 /**
- * Accepts a vector of indices and returns a vector in which each index has
- * been mapped to its associated value in a given state.
- *
- * @param 	state 		A reference to a vector describing a possible game state
- * @param 	indices 	A list of item indices associated with the game state
+ * Solves the current board through the cache. The board is canonicalized; on a hit, the
+ * cached solution of the canonical form is mapped back through the board's transform,
+ * and on a miss the board is searched and the image of its solution is cached. The
+ * canonicalization is counted as part of the load phase.
  */
-vector<int> Sudoku::getValuesByIndices(const vector<int>& state, const vector<int>& indices) const {
-	vector<int> ret;
-	for(int i = 0; i < indices.size(); i++) {
-		int value = state[indices[i]];
-		ret.push_back(value);
+Sudoku::Result Sudoku::solveCached(const SearchLimits& limits) {
+	PhaseTimer timer;
+	Board canonical;
+	BoardTransform transform;
+	BoardTransform::canonicalize(this->current_board, canonical, transform);
+	double canonical_seconds = timer.lap();
+	Board solution;
+	bool solvable = false;
+	if(this->cache->find(canonical, solution, solvable)) {
+		this->stats.reset();
+		SEARCH_STATS_ONLY(this->recordPhases(canonical_seconds, 0));
+		if(solvable) {
+			transform.invert(solution, this->current_board);
+		}
+		return solvable ? SOLVED : UNSOLVABLE;
+	}
+	Result result = this->solveUncached(limits);
+	SEARCH_STATS_ONLY(this->stats.load_seconds += canonical_seconds);
+	if(result == BUDGET_EXHAUSTED) {
+		return result;
 	}
-	return ret;
+	if(result == SOLVED) {
+		transform.apply(this->current_board, solution);
+	}
+	this->cache->insert(canonical, solution, result == SOLVED);
+	return result;
 }
 
-/**
- * Returns a boolean value indicating whether a given game state has a valid configuration.
- * The method makes nine iterations; within each iteration, it determines three value sets -
- * one for the n-th row, one for the n-th column, and one for the n-th square - and tests
- * whether or not any of these value sets contain duplicate digit values (not including a
- * value of negative one, allowing for missing or unsolved values).
- *
- * @param 	state 	A reference to a vector describing a possible game state
- */
-bool Sudoku::isValid(const vector<int>& state) const {
-	//Iterate through each possible row-column-square index
-	for(int i = 0; i < DIGITS.size(); i++) {
-		vector<int> row_values = getValuesByIndices(state, getIndicesOfRow(i));
-		vector<int> col_values = getValuesByIndices(state, getIndicesOfCol(i));
-		vector<int> square_values = getValuesByIndices(state, getIndicesOfSquare(i));
-		/*
-		//Debugging
-		cout << "\nContains duplicate digits in row " << i << ": " << containsDuplicateDigits(row_values) << "\n";
-		cout << "\nContains duplicate digits in col " << i << ": " << containsDuplicateDigits(col_values) << "\n";
-		cout << "\nContains duplicate digits in square " << i << ": " << containsDuplicateDigits(square_values) << "\n";
-		*/
-		if(containsDuplicateDigits(row_values) ||
-		   containsDuplicateDigits(col_values) || 
-		   containsDuplicateDigits(square_values)) {
-			return false;
+//Searches for a solution of the current board with the selected engine, on one thread
+//or several, within the given limits, recording the search's counters
+Sudoku::Result Sudoku::solveUncached(const SearchLimits& limits) {
+	this->stats.reset();
+	PhaseTimer timer;
+	if(this->isParallel()) {
+		ParallelSearch search(this->getPool(), this->backtracker);
+		search.setLimits(limits);
+		Board solution;
+		bool solved = search.solve(this->current_board, solution);
+		this->stats = search.getStats();
+		SEARCH_STATS_ONLY(this->recordPhases(0, timer.lap()));
+		if(solved) {
+			this->current_board = solution;
+			return SOLVED;
 		}
+		return search.isExhausted() ? BUDGET_EXHAUSTED : UNSOLVABLE;
 	}
-	return true;
+	Solver& solver = this->getSolver();
+	//A board that already contains a conflict can never be solved
+	bool loaded = solver.load(this->current_board);
+	double load_seconds = timer.lap();
+	if(!loaded) {
+		SEARCH_STATS_ONLY(this->recordPhases(load_seconds, 0));
+		return UNSOLVABLE;
+	}
+	solver.setLimits(limits);
+	bool solved = solver.solve();
+	this->stats = solver.getStats();
+	SEARCH_STATS_ONLY(this->recordPhases(load_seconds, timer.lap()));
+	if(solved) {
+		solver.getBoard(this->current_board);
+		return SOLVED;
+	}
+	return solver.isExhausted() ? BUDGET_EXHAUSTED : UNSOLVABLE;
 }
 
-/**
- * Returns a boolean value indicating whether a given game state has both
- * a valid contiguration and contains no missing values.
- */
-bool Sudoku::isComplete(const vector<int>& state) const {
-	for(int i = 0; i < state.size(); i++) {
-		if(state[i] == -1) return false;
+//Returns the editing state of current_board, first rebuilding it if the board has been
+//replaced since it was last used
+BoardEditor& Sudoku::getEditor() const {
+	if(this->editor_stale) {
+		this->editor.load(this->current_board);
+		this->editor_stale = false;
 	}
-	return isValid(state);
+	return this->editor;
 }
 
-vector< vector<int> > Sudoku::getValidSuccessors(const vector<int>& state) {
-	vector< vector<int> > ret;
-	//Determine the index of the next missing value
-	int first_missing_index;
-	for(int item_index = 0; item_index < state.size(); item_index++) {
-		if(state[item_index] == -1) {
-			first_missing_index = item_index;
-			break;
-		}
+//Returns the search engine selected by the strategy member
+Solver& Sudoku::getSolver() {
+	switch(this->strategy) {
+		case DANCING_LINKS:
+			return this->dancing_links;
+		case TEMPLATES:
+			return this->digit_templates;
+		case BACKTRACKING:
+		default:
+			return this->backtracker;
 	}
-	//Iterate through each possible digit value
-	for(int digits_index = 0; digits_index < DIGITS.size(); digits_index++) {
-		//Create a temporary board state using the current digit, and test the state's validity
-		vector<int> temp = state;	
-		temp[first_missing_index] = DIGITS[digits_index];
-		if(isValid(temp)) {
-			//cout << "Solved for value " << temp[first_missing_index] << " at index " << first_missing_index << "\n";
-			//cout << "Adding new potential stat e to ret\n";
-			ret.push_back(temp);
-		}
+}
+
+//Returns the pool of worker threads for parallel searches, starting it (or restarting it,
+//if the number of threads has changed since) as needed
+ThreadPool& Sudoku::getPool() {
+	if(this->workers.pool != NULL && this->workers.pool->size() != this->threads) {
+		delete this->workers.pool;
+		this->workers.pool = NULL;
 	}
-	return ret;
+	if(this->workers.pool == NULL) {
+		this->workers.pool = new ThreadPool(this->threads);
+	}
+	return *this->workers.pool;
+}
+
+//Returns whether searches should be split across several threads
+bool Sudoku::isParallel() const {
+	return this->threads > 1 && this->strategy == BACKTRACKING;
+}
+
+//Triages current_board, if triage is enabled, counting the time taken as the load phase.
+//Returns false if the board was rejected, leaving the stats member with no search in it.
+bool Sudoku::passesTriage() {
+	if(!this->triaging) {
+		this->triage.reset();
+		return true;
+	}
+	PhaseTimer timer;
+	if(this->triage.checkBoard(this->current_board)) {
+		return true;
+	}
+	this->stats.reset();
+	SEARCH_STATS_ONLY(this->recordPhases(timer.lap(), 0));
+	return false;
 }
 
 /**
- * A recursive approach to solving incomplete Sudoku games. Returns a boolean value
- * indicating whether the provided state could be solved (assigning the current_board
- * member to the resulting solved state must be accomplished as a side-effect).
+ * Counts (and optionally enumerates) the solutions of the current board with the
+ * selected engine, on one thread or several, recording the search's counters.
  *
- * @param 	state 	A reference to a vector describing a possible game state
- */
-bool Sudoku::solve(const vector<int>& state) {
-	vector<int> board = state;
-	//Test whether the board that was passed in is complete (exit condition)
-	if(isComplete(board)) {
-		//Class member assignment as side-effect
-		this->current_board = board;
-		return true;
+ * @param 	limit 		The number of solutions at which to stop (zero for no limit)
+ * @param 	callback 	If not NULL, receives each solution
+ */
+long Sudoku::enumerate(long limit, SolutionCallback* callback) {
+	long found = 0;
+	if(!this->passesTriage()) {
+		return found;
+	}
+	const Board& start = this->triaging ? this->triage.getFilledBoard() : this->current_board;
+	this->stats.reset();
+	PhaseTimer timer;
+	if(this->isParallel()) {
+		ParallelSearch search(this->getPool(), this->backtracker);
+		found = search.countSolutions(start, limit, callback);
+		this->stats = search.getStats();
+		SEARCH_STATS_ONLY(this->recordPhases(0, timer.lap()));
 	} else {
-		//Recursive solving algorithm: Generate a list of all 'next moves' which are
-		//valid, calling solve() recursively on each
-		vector< vector<int> >successors = getValidSuccessors(board);
-		for(int i = 0; i < successors.size(); i++) {
-			if(solve(successors[i])) {
-				return true;
-			}
+		Solver& solver = this->getSolver();
+		bool loaded = solver.load(start);
+		double load_seconds = timer.lap();
+		solver.setLimits(SearchLimits());
+		if(loaded) {
+			found = solver.countSolutions(limit, callback);
+			this->stats = solver.getStats();
 		}
-		//We've hit a potential dead-end, so return false to end any more recursion
-		//down the current rabbit-hole
-		return false;
+		SEARCH_STATS_ONLY(this->recordPhases(load_seconds, timer.lap()));
 	}
+	return found;
 }
 
+/**
+ * Records the time spent in each phase of a search in the stats member: the load phase
+ * as measured, and the search phase as whatever part of the solve time the engine did
+ * not spend propagating (with several threads, propagation time is summed over them,
+ * so this is only an estimate).
+ *
+ * @param 	load_seconds 	The time spent loading and checking the board
+ * @param 	solve_seconds 	The time spent in the engine's search, propagation included
+ */
+void Sudoku::recordPhases(double load_seconds, double solve_seconds) {
+	this->stats.load_seconds = load_seconds;
+	double search_seconds = solve_seconds - this->stats.propagation_seconds;
+	this->stats.search_seconds = (search_seconds > 0) ? search_seconds : 0;
+}
+
+/**
+ * Returns a boolean value indicating whether a given board has a valid configuration.
+ * The board's 27 units are checked at once by the vectorized kernel in BoardKernels
+ * (missing or unsolved values are zero, and are skipped).
+ *
+ * @param 	state 	A reference to a board
+ */
+bool Sudoku::isValid(const Board& state) const {
+	return BoardKernels::isValid(state.data());
+}
+
+/**
+ * Returns a boolean value indicating whether a given board has both
+ * a valid contiguration and contains no missing values.
+ */
+bool Sudoku::isComplete(const Board& state) const {
+	for(int i = 0; i < 81; i++) {
+		if(state.isEmpty(i)) return false;
+	}
+	return isValid(state);
+}
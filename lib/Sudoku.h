@@ -14,34 +14,134 @@
 #include <string>
 #include <vector>
 
+//Header includes (for member types)
+#include "Board.h"
+#include "Backtracker.h"
+#include "DancingLinks.h"
+#include "DigitTemplates.h"
+#include "SolutionCache.h"
+#include "BoardEditor.h"
+#include "Triage.h"
+#include "SolutionIterator.h"
+#include "ThreadPool.h"
+
 using namespace std;
 
 class Sudoku {
 
+public:
+
+	//The search engines available to Sudoku::solve
+	enum Strategy {
+		BACKTRACKING,
+		DANCING_LINKS,
+		TEMPLATES
+	};
+
+	//The outcome of a search run under SearchLimits
+	enum Result {
+		SOLVED,
+		UNSOLVABLE,
+		//The search ran out of budget before finding a solution or ruling one out
+		BUDGET_EXHAUSTED
+	};
+
 private:
 
-	vector<int> starting_board;
-	vector<int> current_board;
-	//Private helped functions
-	vector<int> getValuesByIndices(const vector<int>& state, const vector<int>& indices) const;
+	Board starting_board;
+	Board current_board;
+	Strategy strategy;
+	//Number of threads used to search a single board (backtracking strategy only)
+	int threads;
+	//Owns the worker threads of parallel searches, started on first use and kept for
+	//later ones. A copy of a Sudoku starts without a pool of its own.
+	struct PoolHolder {
+		ThreadPool* pool;
+		PoolHolder() : pool(NULL) {
+		}
+		PoolHolder(const PoolHolder&) : pool(NULL) {
+		}
+		PoolHolder& operator=(const PoolHolder&) {
+			return *this;
+		}
+		~PoolHolder() {
+			delete this->pool;
+		}
+	};
+	PoolHolder workers;
+	//Counters describing the most recent search
+	SearchStats stats;
+	//Search engines; the one selected by the strategy member solves a copy of current_board
+	Backtracker backtracker;
+	DancingLinks dancing_links;
+	DigitTemplates digit_templates;
+	//Shared cache of solutions consulted by solve() (not owned; NULL for none)
+	SolutionCache* cache;
+	//Whether boards are triaged before every search, and the result for the last one
+	bool triaging;
+	Triage triage;
+	//Incremental state of current_board for cell-by-cell editing, rebuilt on first use
+	//after the board is replaced wholesale (by setState or solve)
+	mutable BoardEditor editor;
+	mutable bool editor_stale;
+	BoardEditor& getEditor() const;
+	Solver& getSolver();
+	ThreadPool& getPool();
+	bool isParallel() const;
+	bool passesTriage();
+	Result solveCached(const SearchLimits& limits);
+	Result solveUncached(const SearchLimits& limits);
+	long enumerate(long limit, SolutionCallback* callback);
+	void recordPhases(double load_seconds, double solve_seconds);
 	//Private versions of Sudoku::isValid and Sudoku::isComplete
-	bool isValid(const vector<int>& state) const;
-	bool isComplete(const vector<int>& state) const;
-	vector< vector<int> > getValidSuccessors(const vector<int>& state);
-	bool solve(const vector<int>& state);
+	bool isValid(const Board& state) const;
+	bool isComplete(const Board& state) const;
 
 public:
 
-	Sudoku(const string& state_str);
+	Sudoku(const string& state_str, Strategy strategy = BACKTRACKING);
+	void setState(const string& state_str);
+	void setState(const char* state, size_t length);
+	void setState(const Board& state);
 	//Public accessors
 	vector<int> getStartingBoard() const;
 	vector<int> getCurrentBoard() const;
+	const Board& getStartingCells() const;
+	const Board& getCurrentCells() const;
+	Strategy getStrategy() const;
+	void setStrategy(Strategy strategy);
+	bool getPropagation() const;
+	void setPropagation(bool enabled);
+	Backtracker::CellOrder getCellOrder() const;
+	void setCellOrder(Backtracker::CellOrder order);
+	Backtracker::ValueOrder getValueOrder() const;
+	void setValueOrder(Backtracker::ValueOrder order);
+	int getThreads() const;
+	void setThreads(int threads);
+	SolutionCache* getCache() const;
+	void setCache(SolutionCache* cache);
+	bool getTriage() const;
+	void setTriage(bool enabled);
+	const Triage& getTriageResult() const;
+	const SearchStats& getStats() const;
 	
 	void printCurrentBoard() const;
 	
 	bool isValid() const;
 	bool isComplete() const;
+	bool setCell(int index, int digit);
+	bool clearCell(int index);
+	bool undo();
+	vector<int> getCandidates(int index) const;
+	vector<int> getConflicts() const;
+	bool isSolvable();
+	bool getHint(int& index, int& digit);
 	bool solve();
+	Result solve(const SearchLimits& limits);
+	long countSolutions(long limit = 0);
+	bool hasUniqueSolution();
+	long forEachSolution(SolutionCallback& callback);
+	SolutionIterator<3> getSolutionIterator() const;
 
 	//Static class members and helper functions
 	static const vector<int> DIGITS;
@@ -49,6 +149,7 @@ public:
 	static vector<int> getIndicesOfRow(int row);
 	static vector<int> getIndicesOfCol(int col);
 	static vector<int> getIndicesOfSquare(int square);
+	static int getSquareByCoordinate(int row, int col);
 	static bool containsDuplicateDigits(const vector<int>& ints);
 
 };
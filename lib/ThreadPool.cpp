@@ -0,0 +1,212 @@
+/**
+ * @file ThreadPool.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the public interface and private methods of the
+ * ThreadPool class. For details about this class, see 'ThreadPool.h'.
+ */
+
+//Protected includes
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+//Header include
+#include "ThreadPool.h"
+
+using namespace std;
+
+//Index of the pool worker running on this thread, or -1 for any other thread
+static thread_local int current_worker = -1;
+//The pool that worker belongs to
+static thread_local const ThreadPool* current_pool = NULL;
+
+/*** Public interface implementation ***/
+
+/**
+ * Public constructor. Starts the given number of worker threads, which sleep until
+ * tasks are submitted.
+ *
+ * @param 	size 	The number of worker threads (at least one is always started)
+ */
+ThreadPool::ThreadPool(int size) : pending(0), stopping(false), next_queue(0) {
+	if(size < 1) {
+		size = 1;
+	}
+	for(int i = 0; i < size; i++) {
+		this->workers.push_back(new Worker());
+	}
+	for(int i = 0; i < size; i++) {
+		this->threads.push_back(thread(&ThreadPool::work, this, i));
+	}
+}
+
+//Destructor. Finishes any outstanding tasks, then stops and joins the workers.
+ThreadPool::~ThreadPool() {
+	this->wait();
+	{
+		lock_guard<mutex> guard(this->idle_lock);
+		this->stopping = true;
+	}
+	this->work_available.notify_all();
+	for(int i = 0; i < this->threads.size(); i++) {
+		this->threads[i].join();
+	}
+	for(int i = 0; i < this->workers.size(); i++) {
+		delete this->workers[i];
+	}
+}
+
+//Returns the number of worker threads
+int ThreadPool::size() const {
+	return this->workers.size();
+}
+
+/**
+ * Queues a task. A worker of this pool queues onto its own deque; any other thread
+ * spreads its tasks over the workers' deques in turn.
+ *
+ * @param 	task 	The task to run
+ */
+void ThreadPool::submit(const Task& task) {
+	int index = current_worker;
+	if(current_pool != this || index < 0) {
+		index = this->next_queue.fetch_add(1) % this->workers.size();
+	}
+	this->pending++;
+	{
+		lock_guard<mutex> guard(this->workers[index]->lock);
+		this->workers[index]->pushBack(task);
+	}
+	//Taking the lock orders this notification after any worker's check for work
+	{
+		lock_guard<mutex> guard(this->idle_lock);
+	}
+	this->work_available.notify_one();
+}
+
+//Blocks until every submitted task (including tasks those tasks submit) has finished
+void ThreadPool::wait() {
+	unique_lock<mutex> guard(this->idle_lock);
+	while(this->pending > 0) {
+		this->all_done.wait(guard);
+	}
+}
+
+/*** Static class method implementations ***/
+
+//Returns the index of the pool worker running on the calling thread, or -1
+int ThreadPool::getCurrentWorker() {
+	return current_worker;
+}
+
+//Returns a sensible pool size for this machine: one worker per hardware thread
+int ThreadPool::getDefaultSize() {
+	int size = thread::hardware_concurrency();
+	return (size > 0) ? size : 1;
+}
+
+/*** Private method implementations ***/
+
+/**
+ * The loop run by each worker thread: run tasks from its own deque, steal when that
+ * is empty, and sleep when there is nothing to steal.
+ *
+ * @param 	index 	The index of this worker
+ */
+void ThreadPool::work(int index) {
+	current_worker = index;
+	current_pool = this;
+	Task task;
+	while(true) {
+		if(this->takeTask(index, task)) {
+			task(index);
+			task = Task();
+			if(--this->pending == 0) {
+				lock_guard<mutex> guard(this->idle_lock);
+				this->all_done.notify_all();
+			}
+			continue;
+		}
+		unique_lock<mutex> guard(this->idle_lock);
+		if(this->stopping) {
+			return;
+		}
+		//Tasks may have been queued since the deques were checked; recheck under the
+		//lock that submit() takes before notifying
+		bool queued = false;
+		for(int i = 0; i < this->workers.size() && !queued; i++) {
+			lock_guard<mutex> queue_guard(this->workers[i]->lock);
+			queued = !this->workers[i]->empty();
+		}
+		if(!queued) {
+			this->work_available.wait(guard);
+		}
+	}
+}
+
+/**
+ * Takes the newest task from a worker's own deque or, failing that, steals the oldest
+ * task from another worker's deque. Returns false if every deque is empty.
+ *
+ * @param 	index 	The index of the worker looking for a task
+ * @param 	task 	Receives the task
+ */
+bool ThreadPool::takeTask(int index, Task& task) {
+	{
+		Worker* own = this->workers[index];
+		lock_guard<mutex> guard(own->lock);
+		if(!own->empty()) {
+			own->popBack(task);
+			return true;
+		}
+	}
+	int count = this->workers.size();
+	for(int offset = 1; offset < count; offset++) {
+		Worker* victim = this->workers[(index + offset) % count];
+		lock_guard<mutex> guard(victim->lock);
+		if(!victim->empty()) {
+			victim->popFront(task);
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Adds a task at the back of a worker's queue, doubling the ring if it is full. The
+ * ring never shrinks, so after the first few bursts of work this allocates nothing.
+ *
+ * @param 	task 	The task to queue
+ */
+void ThreadPool::Worker::pushBack(const Task& task) {
+	if(this->count == this->ring.size()) {
+		vector<Task> grown(this->ring.size() * 2);
+		for(size_t i = 0; i < this->count; i++) {
+			grown[i] = move(this->ring[(this->head + i) % this->ring.size()]);
+		}
+		this->ring.swap(grown);
+		this->head = 0;
+	}
+	this->ring[(this->head + this->count) % this->ring.size()] = task;
+	this->count++;
+}
+
+//Takes the newest task from the back of a non-empty queue
+void ThreadPool::Worker::popBack(Task& task) {
+	size_t slot = (this->head + this->count - 1) % this->ring.size();
+	task = move(this->ring[slot]);
+	this->ring[slot] = nullptr;
+	this->count--;
+}
+
+//Takes the oldest task from the front of a non-empty queue
+void ThreadPool::Worker::popFront(Task& task) {
+	task = move(this->ring[this->head]);
+	this->ring[this->head] = nullptr;
+	this->head = (this->head + 1) % this->ring.size();
+	this->count--;
+}
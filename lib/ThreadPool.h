@@ -0,0 +1,96 @@
+/**
+ * @file ThreadPool.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the ThreadPool class, a fixed set of worker threads which share work by
+ * stealing. Each worker owns a double-ended queue of tasks: it takes its own tasks from
+ * the back (newest first, which keeps a worker on the data it just touched), and when
+ * its queue is empty it steals from the front of another worker's queue (oldest first,
+ * which tend to be the largest pieces of work). Tasks submitted by a worker go onto
+ * that worker's own queue, so a task can split itself into subtasks cheaply.
+ *
+ * Each queue is a ring buffer that only ever grows, so once the pool has warmed up,
+ * queuing and taking tasks never touches the heap (provided the tasks themselves are
+ * small enough for a function object to hold in place, such as a lambda capturing a
+ * couple of pointers).
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+//Protected includes (for argument, return, and member types)
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+using namespace std;
+
+class ThreadPool {
+
+public:
+
+	//A unit of work; receives the index of the worker running it
+	typedef function<void (int)> Task;
+
+	//Tasks each worker's queue can hold before it first has to grow
+	static const size_t INITIAL_CAPACITY = 64;
+
+private:
+
+	//A worker's queue of tasks: a ring buffer of 'count' tasks starting at 'head'
+	struct Worker {
+		vector<Task> ring;
+		size_t head;
+		size_t count;
+		mutex lock;
+
+		Worker() : ring(INITIAL_CAPACITY), head(0), count(0) {
+		}
+
+		bool empty() const {
+			return this->count == 0;
+		}
+
+		void pushBack(const Task& task);
+		void popBack(Task& task);
+		void popFront(Task& task);
+	};
+
+	vector<Worker*> workers;
+	vector<thread> threads;
+
+	//Tasks submitted but not yet finished, and whether the pool is shutting down
+	atomic<long> pending;
+	atomic<bool> stopping;
+	//Used to put idle workers to sleep, and to wake threads waiting on the pool
+	mutex idle_lock;
+	condition_variable work_available;
+	condition_variable all_done;
+	atomic<int> next_queue;
+
+	void work(int index);
+	bool takeTask(int index, Task& task);
+
+	//Non-copyable
+	ThreadPool(const ThreadPool&);
+	ThreadPool& operator=(const ThreadPool&);
+
+public:
+
+	ThreadPool(int size);
+	~ThreadPool();
+
+	int size() const;
+	void submit(const Task& task);
+	void wait();
+
+	static int getCurrentWorker();
+	static int getDefaultSize();
+
+};
+
+#endif
@@ -0,0 +1,402 @@
+/**
+ * @file Triage.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementations for the public interface and private methods of the
+ * Triage class. For details about this class, see 'Triage.h'.
+ */
+
+//Protected includes
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+//Header includes
+#include "Triage.h"
+#include "BoardKernels.h"
+#include "Candidates.h"
+
+using namespace std;
+
+//The board's geometry, read through a reference so it is never copied onto the stack
+static constexpr const BoardTables& TABLES = Board::TABLES;
+
+/*** Public interface implementation ***/
+
+//Public constructor. Starts out with nothing checked, which counts as having passed.
+Triage::Triage() {
+	this->reset();
+}
+
+//Forgets the result of the last check
+void Triage::reset() {
+	this->reason = PASSED;
+	this->index = -1;
+	this->other = -1;
+	this->unit = -1;
+	this->digit = -1;
+	this->length = 0;
+	this->character = '\0';
+	this->propagated = 0;
+	this->filled = Board();
+}
+
+/**
+ * Checks that a run of characters holds a puzzle in the one-line format: exactly 81
+ * characters, each a digit, '.', or '0'. Returns false (recording the reason) if not.
+ *
+ * @param 	text 	The first character of the puzzle
+ * @param 	length 	The number of characters, without any line terminator
+ */
+bool Triage::checkText(const char* text, size_t length) {
+	this->reset();
+	if(length != 81) {
+		this->reject(BAD_LENGTH, -1, -1, -1);
+		this->length = length;
+		return false;
+	}
+	for(int i = 0; i < 81; i++) {
+		if(Board::CHARACTERS.cell_of_char[(unsigned char)text[i]] == Board::INVALID) {
+			this->reject(BAD_CHARACTER, i, -1, -1);
+			this->character = text[i];
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Checks that a board could have a solution as far as the cheap tests can tell: no
+ * invalid cells, no conflicting givens, no empty cell or unit-digit pair without a
+ * place, and no contradiction reached by filling singles. Returns false (recording the
+ * reason) if the board is certainly unsolvable. The board itself is left unchanged; if
+ * it passes, getFilledBoard() returns a copy with the singles filled in.
+ *
+ * @param 	board 	The board to check
+ */
+bool Triage::checkBoard(const Board& board) {
+	this->reset();
+	for(int i = 0; i < 81; i++) {
+		if(board.get(i) > 9) {
+			this->reject(BAD_CHARACTER, i, -1, -1);
+			return false;
+		}
+	}
+	//The vectorized check settles the usual case; only a rejected board is scanned again
+	//to name the conflicting cells
+	if(!BoardKernels::isValid(board.data())) {
+		for(int u = 0; u < 27; u++) {
+			int seen[10];
+			memset(seen, -1, sizeof(seen));
+			for(int k = 0; k < 9; k++) {
+				int cell = TABLES.units[u][k];
+				int value = board.get(cell);
+				if(value == 0) {
+					continue;
+				}
+				if(seen[value] != -1) {
+					this->reject(CONFLICT, seen[value], u, value);
+					this->other = cell;
+					return false;
+				}
+				seen[value] = cell;
+			}
+		}
+	}
+	uint8_t cells[81];
+	unsigned short candidates[81];
+	memcpy(cells, board.data(), sizeof(cells));
+	BoardKernels::getCandidates(cells, candidates);
+	//Dead cells and digits among the givens alone are reported as such; any found later
+	//are the fault of propagation
+	for(int i = 0; i < 81; i++) {
+		if(cells[i] == 0 && candidates[i] == 0) {
+			this->reject(DEAD_CELL, i, -1, -1);
+			return false;
+		}
+	}
+	for(int u = 0; u < 27; u++) {
+		unsigned short placed = 0;
+		unsigned short open = 0;
+		for(int k = 0; k < 9; k++) {
+			int cell = TABLES.units[u][k];
+			if(cells[cell] != 0) {
+				placed |= Candidates::digitToMask(cells[cell]);
+			} else {
+				open |= candidates[cell];
+			}
+		}
+		unsigned short missing = Candidates::ALL_DIGITS & ~placed & ~open;
+		if(missing != 0) {
+			this->reject(DEAD_DIGIT, -1, u, Candidates::lowestDigit(missing));
+			return false;
+		}
+	}
+	if(!this->propagate(cells, candidates)) {
+		return false;
+	}
+	for(int i = 0; i < 81; i++) {
+		this->filled.set(i, cells[i]);
+	}
+	return true;
+}
+
+/**
+ * Checks the text of a puzzle and then, if it is well formed, the board it holds (see
+ * above). Returns false (recording the reason) if either check rejects the puzzle.
+ *
+ * @param 	text 	The first character of the puzzle
+ * @param 	length 	The number of characters, without any line terminator
+ * @param 	board 	Receives the board held by the text, if it is well formed
+ */
+bool Triage::check(const char* text, size_t length, Board& board) {
+	if(!this->checkText(text, length)) {
+		return false;
+	}
+	board.parse(text, length);
+	return this->checkBoard(board);
+}
+
+//Public getter for the reason member
+Triage::Reason Triage::getReason() const {
+	return this->reason;
+}
+
+//Returns whether the last check rejected the puzzle
+bool Triage::isRejected() const {
+	return this->reason != PASSED;
+}
+
+//Public getter for the index member
+int Triage::getIndex() const {
+	return this->index;
+}
+
+//Public getter for the other member
+int Triage::getOtherIndex() const {
+	return this->other;
+}
+
+//Public getter for the unit member
+int Triage::getUnit() const {
+	return this->unit;
+}
+
+//Public getter for the digit member
+int Triage::getDigit() const {
+	return this->digit;
+}
+
+//Public getter for the length member
+size_t Triage::getLength() const {
+	return this->length;
+}
+
+//Public getter for the character member
+char Triage::getCharacter() const {
+	return this->character;
+}
+
+//Public getter for the propagated member
+int Triage::getPropagated() const {
+	return this->propagated;
+}
+
+//Public getter for the filled member; holds an empty board unless the last check passed
+const Board& Triage::getFilledBoard() const {
+	return this->filled;
+}
+
+/**
+ * Writes a short, human-readable description of the last check's result (such as
+ * "cells r1c1 and r1c5 both hold 3 in row 1") into a string.
+ *
+ * @param 	text 	Receives the description
+ */
+void Triage::describe(string& text) const {
+	text.clear();
+	string cell = (this->index >= 0) ? "r" + to_string((this->index / 9) + 1) + "c" + to_string((this->index % 9) + 1) :
+				  "";
+	switch(this->reason) {
+		case PASSED:
+			text = "passed";
+			break;
+		case BAD_LENGTH:
+			text = "expected 81 cells, found " + to_string(this->length);
+			break;
+		case BAD_CHARACTER:
+			if(this->character != '\0') {
+				text = "invalid character '" + string(1, this->character) + "' at position " +
+					   to_string(this->index + 1);
+			} else {
+				text = "invalid value in cell " + cell;
+			}
+			break;
+		case CONFLICT:
+			text = "cells " + cell + " and r" + to_string((this->other / 9) + 1) + "c" +
+				   to_string((this->other % 9) + 1) + " both hold " + to_string(this->digit) + " in ";
+			describeUnit(this->unit, text);
+			break;
+		case DEAD_CELL:
+			text = "no digit can go in cell " + cell;
+			break;
+		case DEAD_DIGIT:
+			text = to_string(this->digit) + " can go nowhere in ";
+			describeUnit(this->unit, text);
+			break;
+		case CONTRADICTION:
+			text = "after filling " + to_string(this->propagated) + " singles, ";
+			if(this->index >= 0) {
+				text += "no digit can go in cell " + cell;
+			} else {
+				text += to_string(this->digit) + " can go nowhere in ";
+				describeUnit(this->unit, text);
+			}
+			break;
+	}
+}
+
+/*** Static class method implementations ***/
+
+//Returns a short name for a reason, suitable for machine-readable output
+const char* Triage::getReasonName(Reason reason) {
+	switch(reason) {
+		case BAD_LENGTH:
+			return "bad-length";
+		case BAD_CHARACTER:
+			return "bad-character";
+		case CONFLICT:
+			return "conflict";
+		case DEAD_CELL:
+			return "dead-cell";
+		case DEAD_DIGIT:
+			return "dead-digit";
+		case CONTRADICTION:
+			return "contradiction";
+		case PASSED:
+		default:
+			return "passed";
+	}
+}
+
+/**
+ * Appends the name of a unit ("row 1", "column 4", or "square 9") to a string.
+ *
+ * @param 	unit 	The index of the unit (rows 0-8, columns 9-17, squares 18-26)
+ * @param 	text 	The string to append to
+ */
+void Triage::describeUnit(int unit, string& text) {
+	const char* kinds[] = {"row ", "column ", "square "};
+	text += kinds[unit / 9];
+	text += to_string((unit % 9) + 1);
+}
+
+/*** Private method implementations ***/
+
+//Records the reason for rejecting a puzzle, along with the cell, unit, and digit involved
+void Triage::reject(Reason reason, int index, int unit, int digit) {
+	this->reason = reason;
+	this->index = index;
+	this->unit = unit;
+	this->digit = digit;
+}
+
+/**
+ * Fills naked singles (cells with one candidate) and hidden singles (digits with one
+ * place left in a unit) until neither rule applies. Returns false (recording where the
+ * contradiction surfaced) if an empty cell or a unit-digit pair runs out of places.
+ *
+ * Naked singles are worked off a stack of the cells whose candidates have just dropped
+ * to one (or none), so the board is only rescanned, unit by unit, for hidden singles.
+ *
+ * @param 	cells 		The board being filled
+ * @param 	candidates 	The candidates of each empty cell, kept up to date
+ */
+bool Triage::propagate(uint8_t* cells, unsigned short* candidates) {
+	//A cell is pushed at most twice: once down to one candidate, and once down to none
+	uint8_t pending[162];
+	int count = 0;
+	for(int i = 0; i < 81; i++) {
+		if(cells[i] == 0 && (candidates[i] & (candidates[i] - 1)) == 0) {
+			pending[count++] = (uint8_t)i;
+		}
+	}
+	while(true) {
+		while(count > 0) {
+			int i = pending[--count];
+			if(cells[i] != 0) {
+				continue;
+			}
+			if(candidates[i] == 0) {
+				this->reject(CONTRADICTION, i, -1, -1);
+				return false;
+			}
+			this->place(cells, candidates, pending, count, i, Candidates::lowestDigit(candidates[i]));
+		}
+		bool changed = false;
+		for(int u = 0; u < 27; u++) {
+			//Digits already placed, with at least one place, and with two or more
+			unsigned short placed = 0;
+			unsigned short once = 0;
+			unsigned short twice = 0;
+			for(int k = 0; k < 9; k++) {
+				int cell = TABLES.units[u][k];
+				if(cells[cell] != 0) {
+					placed |= Candidates::digitToMask(cells[cell]);
+				} else {
+					twice |= once & candidates[cell];
+					once |= candidates[cell];
+				}
+			}
+			unsigned short missing = Candidates::ALL_DIGITS & ~placed & ~once;
+			if(missing != 0) {
+				this->reject(CONTRADICTION, -1, u, Candidates::lowestDigit(missing));
+				return false;
+			}
+			unsigned short singles = once & ~twice;
+			while(singles != 0) {
+				int d = Candidates::lowestDigit(singles);
+				singles &= singles - 1;
+				for(int k = 0; k < 9; k++) {
+					int cell = TABLES.units[u][k];
+					if(cells[cell] == 0 && (candidates[cell] & Candidates::digitToMask(d)) != 0) {
+						this->place(cells, candidates, pending, count, cell, d);
+						changed = true;
+						break;
+					}
+				}
+			}
+		}
+		if(!changed && count == 0) {
+			return true;
+		}
+	}
+}
+
+/**
+ * Fills a cell with a digit, removing the digit from the candidates of its peers and
+ * pushing any peer left with one candidate (or none) onto the stack of pending cells.
+ *
+ * @param 	cells 		The board being filled
+ * @param 	candidates 	The candidates of each empty cell
+ * @param 	pending 	The stack of cells to be checked for naked singles
+ * @param 	count 		The number of cells on the stack
+ * @param 	index 		The cell to fill
+ * @param 	digit 		The digit to fill it with
+ */
+void Triage::place(uint8_t* cells, unsigned short* candidates, uint8_t* pending, int& count, int index, int digit) {
+	unsigned short mask = Candidates::digitToMask(digit);
+	cells[index] = (uint8_t)digit;
+	candidates[index] = 0;
+	for(int k = 0; k < 20; k++) {
+		int peer = TABLES.peers[index][k];
+		if(cells[peer] == 0 && (candidates[peer] & mask) != 0) {
+			candidates[peer] &= ~mask;
+			if((candidates[peer] & (candidates[peer] - 1)) == 0) {
+				pending[count++] = (uint8_t)peer;
+			}
+		}
+	}
+	this->propagated++;
+}
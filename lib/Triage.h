@@ -0,0 +1,109 @@
+/**
+ * @file Triage.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the Triage class, a cheap front-line stage that turns away puzzles no
+ * search could solve before one is run. Garbage and impossible inputs would otherwise
+ * cost a full, exhaustive search each (the worst case of every engine), while the
+ * checks here cost a few microseconds:
+ *
+ *  - the text must hold exactly 81 cells, each a digit, '.', or '0';
+ *  - no two givens may share a digit within a row, column, or square;
+ *  - every empty cell needs a candidate, and every digit missing from a unit needs a
+ *    cell of the unit to go in;
+ *  - filling naked and hidden singles to a fixed point must not run into a
+ *    contradiction (an empty cell or a unit-digit pair left without a place).
+ *
+ * A rejected puzzle is described by a structured reason (see Triage::Reason), naming
+ * the cells, unit, and digit involved, so that callers can report why it was rejected.
+ * A puzzle that passes may still be unsolvable; that takes a search to find out, which
+ * can start from the board with the singles filled in (they hold in every solution),
+ * so the work done here is not done twice.
+ */
+
+#ifndef TRIAGE_H
+#define TRIAGE_H
+
+//Protected includes (for argument types)
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+//Header include (for argument types)
+#include "Board.h"
+
+using namespace std;
+
+class Triage {
+
+public:
+
+	enum Reason {
+		//No reason was found to reject the puzzle
+		PASSED,
+		//The text does not hold exactly 81 cells
+		BAD_LENGTH,
+		//A character (or cell) is neither a digit nor a missing value
+		BAD_CHARACTER,
+		//Two givens share a digit within a unit
+		CONFLICT,
+		//An empty cell has no candidates among the givens
+		DEAD_CELL,
+		//A digit missing from a unit can go in none of the unit's empty cells
+		DEAD_DIGIT,
+		//Propagating singles from the givens leads to a dead cell or digit
+		CONTRADICTION
+	};
+
+private:
+
+	Reason reason;
+	//The cell rejected (for a bad character, its position in the text), the other cell
+	//of a conflict, the unit (rows 0-8, columns 9-17, squares 18-26), and the digit
+	//involved; each is -1 where it doesn't apply
+	int index;
+	int other;
+	int unit;
+	int digit;
+	//The length of the text (for BAD_LENGTH) and the offending character (for BAD_CHARACTER)
+	size_t length;
+	char character;
+	//Cells filled by propagation before the puzzle was rejected or passed, and the board
+	//with them filled in (after a board that passed)
+	int propagated;
+	Board filled;
+
+	void reject(Reason reason, int index, int unit, int digit);
+	bool propagate(uint8_t* cells, unsigned short* candidates);
+	void place(uint8_t* cells, unsigned short* candidates, uint8_t* pending, int& count, int index, int digit);
+
+public:
+
+	Triage();
+
+	void reset();
+	bool checkText(const char* text, size_t length);
+	bool checkBoard(const Board& board);
+	bool check(const char* text, size_t length, Board& board);
+
+	//Public accessors
+	Reason getReason() const;
+	bool isRejected() const;
+	int getIndex() const;
+	int getOtherIndex() const;
+	int getUnit() const;
+	int getDigit() const;
+	size_t getLength() const;
+	char getCharacter() const;
+	int getPropagated() const;
+	const Board& getFilledBoard() const;
+	void describe(string& text) const;
+
+	//Static helper functions
+	static const char* getReasonName(Reason reason);
+	static void describeUnit(int unit, string& text);
+
+};
+
+#endif
@@ -3,67 +3,500 @@
  * @author Michael Zalla
  * @date 9-28-2013
  *
- * Demonstrates the game-solving functionality of the Sudoku class.
+ * Demonstrates the game-solving functionality of the Sudoku class. Given a single
+ * puzzle file, prints the puzzle and its solution; with --batch, solves a whole corpus
+ * of one-line puzzles (from a file, or from standard input) and reports throughput.
  */
 
 #include <fstream>
 #include <iostream>
 #include <string>
 #include <cstdlib>
-#include <stdexcept>
+#include <csignal>
+#include <atomic>
+#include <unistd.h>
 #include "lib/Sudoku.h"
+#include "lib/BatchSolver.h"
+#include "lib/PuzzleReader.h"
+#include "lib/GridPuzzle.h"
+#include "lib/Generator.h"
+#include "lib/SolutionCache.h"
+#include "lib/SolverServer.h"
+#include "lib/BinaryFormat.h"
+#include "lib/Triage.h"
 #include "utils/utils.h"
 
 using namespace std;
 
+//Number of solutions kept when a cache file is given without a capacity
+const long DEFAULT_CACHE_CAPACITY = 100000;
+
+//Prints a summary of the command-line interface
+void printUsage() {
+	cout << "Usage: Sudoku [options] <file>\n"
+			"       Sudoku [options] --batch [file]\n"
+			"       Sudoku [options] --generate N\n"
+			"       Sudoku [options] --serve [--socket PATH]\n"
+			"       Sudoku --convert [--index] <input> <output>\n\n"
+			"Options:\n"
+			"  --batch               Solve one puzzle per line (81 characters, '.' or '0' for\n"
+			"                        blanks) from the file, or from standard input if the\n"
+			"                        file is omitted or '-'. Prints one result per line.\n"
+			"                        A binary corpus file is recognized and read directly.\n"
+			"  --binary-output       With --batch, write binary solution records instead\n"
+			"  --convert             Convert a one-line text corpus to the binary format\n"
+			"                        (with --index, recording each puzzle's source line), or\n"
+			"                        a binary corpus back to text; '-' for standard output\n"
+			"  --threads N           Use N worker threads (0 for one per core): a batch is\n"
+			"                        spread over them, and a single puzzle's search tree\n"
+			"                        is split between them\n"
+			"  --strategy=NAME       Search engine: 'backtracking' (default), 'dlx', or\n"
+			"                        'templates' (digit templates, quickest to enumerate)\n"
+			"  --propagate           Run constraint propagation before every branch\n"
+			"  --mrv                 Branch on the cell with the fewest candidates\n"
+			"  --lcv                 Try the least-constraining digit first\n"
+			"  --no-triage           Search every puzzle, rather than first turning away those\n"
+			"                        with conflicting givens or an early contradiction\n"
+			"  --cache N             Keep the solutions of up to N puzzles, shared by every\n"
+			"                        puzzle that is a relabeling, transposition, or row or\n"
+			"                        column permutation of one already solved\n"
+			"  --cache-file PATH     Load the cache from PATH first, and save it there after\n"
+			"  --serve               Stay resident, answering requests ('<id> <puzzle>', one\n"
+			"                        per line) from standard input with '<id> <solution>',\n"
+			"                        '<id> unsolvable', '<id> exhausted', or\n"
+			"                        '<id> error <message>'\n"
+			"  --socket PATH         With --serve, take requests from connections to a Unix\n"
+			"                        socket at PATH instead, until interrupted\n"
+			"  --timeout-ms N        Give up on a single puzzle (or, with --serve, a request)\n"
+			"                        after N milliseconds\n"
+			"  --max-nodes N         Give up on a puzzle (or request) after N search nodes\n\n";
+}
+
+/**
+ * Applies a single search option to a Sudoku object. Returns false if the argument is
+ * not a recognized search option.
+ *
+ * @param 	arg 	A command-line argument
+ * @param 	s 		The Sudoku object to configure
+ */
+bool applySearchOption(const string& arg, Sudoku& s) {
+	if(arg == "--strategy=backtracking") {
+		s.setStrategy(Sudoku::BACKTRACKING);
+	} else if(arg == "--strategy=dlx") {
+		s.setStrategy(Sudoku::DANCING_LINKS);
+	} else if(arg == "--strategy=templates") {
+		s.setStrategy(Sudoku::TEMPLATES);
+	} else if(arg == "--no-triage") {
+		s.setTriage(false);
+	} else if(arg == "--propagate") {
+		s.setPropagation(true);
+	} else if(arg == "--mrv") {
+		s.setCellOrder(Backtracker::MINIMUM_REMAINING_VALUES);
+	} else if(arg == "--lcv") {
+		s.setValueOrder(Backtracker::LEAST_CONSTRAINING);
+	} else {
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Prints the counters and phase times collected by a search.
+ *
+ * @param 	stats 	The counters of a search
+ */
+void printStats(const SearchStats& stats) {
+	cout << "\nSearch statistics:\n"
+		 << "  Nodes visited:        " << stats.nodes << "\n"
+		 << "  Cells branched on:    " << stats.branches << " (" << stats.getCandidatesPerBranch()
+		 << " candidates tried per cell)\n"
+		 << "  Backtracks:           " << stats.backtracks << "\n"
+		 << "  Maximum depth:        " << stats.max_depth << "\n"
+		 << "  Naked singles:        " << stats.naked_singles << "\n"
+		 << "  Hidden singles:       " << stats.hidden_singles << "\n"
+		 << "  Locked candidates:    " << stats.locked_candidates << "\n"
+		 << "  Load time:            " << stats.load_seconds * 1e6 << "us\n"
+		 << "  Propagation time:     " << stats.propagation_seconds * 1e6 << "us\n"
+		 << "  Search time:          " << stats.search_seconds * 1e6 << "us\n";
+}
+
+/**
+ * Solves every puzzle in a one-puzzle-per-line corpus, writing results to standard
+ * output and a throughput summary to standard error. Corpus files are memory-mapped
+ * and solved in place; anything that can't be mapped (such as a pipe) is streamed.
+ * Grids of another size than 9x9 are read and written as text only.
+ *
+ * @param 	input_path 		The path of the corpus, or '-' for standard input
+ * @param 	configuration 	A Sudoku object configured with the desired search options
+ * @param 	threads 		The number of worker threads to solve with
+ * @param 	statistics 		Whether to report the search counters of every puzzle
+ * @param 	binary_output 	Whether to write binary solution records instead of text
+ * @param 	side 			The side length of the corpus's grids
+ */
+int runBatch(const string& input_path, const Sudoku& configuration, int threads, bool statistics,
+			 bool binary_output, int side) {
+	bool binary_input = input_path != "-" && BinaryFormat::isBinaryFile(input_path);
+	if(side != 9 && (binary_output || binary_input)) {
+		cerr << "Error: Binary corpora hold 9x9 grids only.\n\n";
+		return EXIT_FAILURE;
+	}
+	BatchSolver batch(configuration, threads);
+	batch.setStatistics(statistics);
+	batch.setBinaryOutput(binary_output);
+	batch.setSide(side);
+	BatchSummary summary;
+	MappedPuzzleReader mapped;
+	BinaryPuzzleReader binary;
+	if(input_path == "-") {
+		summary = batch.run(cin, cout);
+	} else if(binary_input) {
+		if(!binary.open(input_path)) {
+			cerr << "Error: '" << input_path << "' is not a readable binary corpus.\n\n";
+			return EXIT_FAILURE;
+		}
+		summary = batch.run(binary, cout);
+	} else if(mapped.open(input_path)) {
+		summary = batch.run(mapped, cout);
+	} else {
+		ifstream input_handle(input_path.c_str());
+		if(!input_handle.is_open()) {
+			cerr << "Error: Unable to open '" << input_path << "'.\n\n";
+			return EXIT_FAILURE;
+		}
+		summary = batch.run(input_handle, cout);
+	}
+	cerr << "Solved " << summary.solved << " of " << summary.puzzles << " puzzles ("
+		 << summary.unsolvable << " unsolvable, " << summary.invalid << " invalid) in "
+		 << summary.seconds << "s on " << batch.getThreads() << " thread(s): "
+		 << summary.getPuzzlesPerSecond() << " puzzles/sec\n";
+	if(statistics) {
+		string totals;
+		BatchSolver::formatStats(summary.stats, totals);
+		cerr << "Search totals: " << totals << "\n";
+	}
+	SolutionCache* cache = configuration.getCache();
+	if(cache != NULL) {
+		cerr << "Cache: " << cache->getHits() << " hits, " << cache->getMisses() << " misses, "
+			 << cache->size() << " of " << cache->getCapacity() << " entries used\n";
+	}
+	return EXIT_SUCCESS;
+}
+
+//The server to stop when the process is interrupted, while one is listening. Read by
+//a signal handler, so it must be lock-free; stop() itself only stores to lock-free
+//atomics and calls shutdown(), which are safe there too.
+atomic<SolverServer*> active_server(NULL);
+static_assert(ATOMIC_POINTER_LOCK_FREE == 2, "the signal handler needs a lock-free pointer");
+
+//Signal handler stopping the active server
+void stopServer(int) {
+	SolverServer* server = active_server.load();
+	if(server != NULL) {
+		server->stop();
+	}
+}
+
+/**
+ * Runs the solver as a server, answering requests from standard input (or from the
+ * connections to a Unix socket, until the process is interrupted) and writing a
+ * summary to standard error once done.
+ *
+ * @param 	configuration 	A Sudoku object configured with the desired search options
+ * @param 	threads 		The number of worker threads to solve with
+ * @param 	socket_path 	The path of the socket to listen on, or empty for standard input
+ * @param 	timeout 		The latency cap of each request, in seconds (zero for none)
+ * @param 	max_nodes 		The node budget of each request (zero for none)
+ */
+int runServer(const Sudoku& configuration, int threads, const string& socket_path, double timeout, long max_nodes) {
+	//A client that goes away mid-response must not take the server down with it
+	signal(SIGPIPE, SIG_IGN);
+	SolverServer server(configuration, threads);
+	server.setTimeout(timeout);
+	server.setMaxNodes(max_nodes);
+	if(socket_path.empty()) {
+		server.serve(STDIN_FILENO, STDOUT_FILENO);
+	} else {
+		active_server = &server;
+		signal(SIGINT, stopServer);
+		signal(SIGTERM, stopServer);
+		bool listened = server.listen(socket_path);
+		active_server = NULL;
+		if(!listened) {
+			cerr << "Error: Unable to listen on '" << socket_path << "'.\n\n";
+			return EXIT_FAILURE;
+		}
+	}
+	cerr << "Answered " << server.getRequests() << " requests on " << server.getThreads() << " thread(s)\n";
+	return EXIT_SUCCESS;
+}
+
+/**
+ * Converts a corpus between the one-line text format and the binary format, in the
+ * direction given by the input: a binary corpus becomes text, and anything else becomes
+ * a binary file of puzzles.
+ *
+ * @param 	input_path 		The path of the corpus to convert, or '-' for standard input
+ * @param 	output_path 	The path to write, or '-' for standard output
+ * @param 	indexed 		Whether a binary file records the source line of every puzzle
+ */
+int runConvert(const string& input_path, const string& output_path, bool indexed) {
+	ofstream output_file;
+	if(output_path != "-") {
+		output_file.open(output_path.c_str(), ios::binary | ios::trunc);
+		if(!output_file.is_open()) {
+			cerr << "Error: Unable to write '" << output_path << "'.\n\n";
+			return EXIT_FAILURE;
+		}
+	}
+	ostream& output = (output_path == "-") ? cout : output_file;
+	long records;
+	if(input_path != "-" && BinaryFormat::isBinaryFile(input_path)) {
+		BinaryPuzzleReader reader;
+		if(!reader.open(input_path)) {
+			cerr << "Error: '" << input_path << "' is not a readable binary corpus.\n\n";
+			return EXIT_FAILURE;
+		}
+		records = BinaryPuzzleReader::convertToText(reader, output);
+	} else {
+		ifstream input_file;
+		if(input_path != "-") {
+			input_file.open(input_path.c_str());
+			if(!input_file.is_open()) {
+				cerr << "Error: Unable to open '" << input_path << "'.\n\n";
+				return EXIT_FAILURE;
+			}
+		}
+		records = BinaryFormat::convertToBinary((input_path == "-") ? cin : input_file, output, indexed);
+	}
+	if(!output.good()) {
+		cerr << "Error: Unable to write '" << output_path << "'.\n\n";
+		return EXIT_FAILURE;
+	}
+	cerr << "Converted " << records << " records\n";
+	return EXIT_SUCCESS;
+}
+
+/**
+ * Generates puzzles with unique solutions, writing them to standard output in the
+ * one-line format and a summary to standard error.
+ *
+ * @param 	generator 	A Generator configured with the desired options
+ * @param 	count 		The number of puzzles to generate
+ */
+int runGenerator(Generator& generator, long count) {
+	GeneratorSummary summary = generator.run(count, cout);
+	cerr << "Generated " << summary.puzzles << " puzzles (" << summary.getMeanClues() << " clues on average, "
+		 << summary.above_target << " above the target) in " << summary.seconds << "s on "
+		 << generator.getThreads() << " thread(s): " << summary.getPuzzlesPerSecond() << " puzzles/sec\n";
+	return EXIT_SUCCESS;
+}
+
 int main(int argc, const char* argv[]) {
 
 	string input_path;
 	ifstream input_handle;
 	string state;
 
-	if(argc < 2) {
-		cout << "Error: Missing input filename.\n\n";
+	//Search options are collected on a template object, which the batch copies
+	Sudoku configuration("");
+	bool batch = false;
+	int threads = 1;
+	int side = 9;
+	bool statistics = false;
+	Generator generator;
+	long generate = -1;
+	long cache_capacity = 0;
+	string cache_path;
+	bool serve = false;
+	string socket_path;
+	long timeout_ms = 0;
+	long max_nodes = 0;
+	bool binary_output = false;
+	bool convert = false;
+	bool indexed = false;
+	string output_path;
+
+	for(int i = 1; i < argc; i++) {
+		string arg = argv[i];
+		if(arg == "--help" || arg == "-h") {
+			printUsage();
+			return EXIT_SUCCESS;
+		} else if(arg == "--batch") {
+			batch = true;
+		} else if(arg == "--binary-output") {
+			binary_output = true;
+		} else if(arg == "--convert") {
+			convert = true;
+		} else if(arg == "--index") {
+			indexed = true;
+		} else if(arg == "--serve") {
+			serve = true;
+		} else if(arg == "--socket" && i + 1 < argc) {
+			socket_path = argv[++i];
+		} else if(arg == "--timeout-ms" && i + 1 < argc && Utilities::isDigits(argv[i + 1])) {
+			timeout_ms = strtol(argv[++i], NULL, 10);
+		} else if(arg == "--max-nodes" && i + 1 < argc && Utilities::isDigits(argv[i + 1])) {
+			max_nodes = strtol(argv[++i], NULL, 10);
+		} else if(arg == "--stats") {
+			statistics = true;
+		} else if(arg == "--generate" && i + 1 < argc && Utilities::isDigits(argv[i + 1])) {
+			generate = strtol(argv[++i], NULL, 10);
+		} else if(arg == "--clues" && i + 1 < argc && Utilities::isDigits(argv[i + 1])) {
+			generator.setClues(Utilities::stringToInt(argv[++i]));
+		} else if(arg == "--seed" && i + 1 < argc && Utilities::isDigits(argv[i + 1])) {
+			generator.setSeed(strtoull(argv[++i], NULL, 10));
+		} else if(arg == "--cache" && i + 1 < argc && Utilities::isDigits(argv[i + 1])) {
+			cache_capacity = strtol(argv[++i], NULL, 10);
+		} else if(arg == "--cache-file" && i + 1 < argc) {
+			cache_path = argv[++i];
+		} else if(arg.compare(0, 11, "--symmetry=") == 0) {
+			Generator::Symmetry symmetry;
+			if(!Generator::parseSymmetry(arg.substr(11), symmetry)) {
+				cout << "Error: Unknown symmetry '" << arg.substr(11) << "'.\n\n";
+				return EXIT_FAILURE;
+			}
+			generator.setSymmetry(symmetry);
+		} else if(arg == "--threads" && i + 1 < argc && Utilities::isDigits(argv[i + 1])) {
+			threads = Utilities::stringToInt(argv[++i]);
+		} else if(arg.compare(0, 10, "--threads=") == 0 && Utilities::isDigits(arg.substr(10))) {
+			threads = Utilities::stringToInt(arg.substr(10));
+		} else if(arg == "--size" && i + 1 < argc && Utilities::isDigits(argv[i + 1])) {
+			side = Utilities::stringToInt(argv[++i]);
+		} else if(arg.compare(0, 7, "--size=") == 0 && Utilities::isDigits(arg.substr(7))) {
+			side = Utilities::stringToInt(arg.substr(7));
+		} else if(applySearchOption(arg, configuration)) {
+			continue;
+		} else if(arg.size() > 1 && arg[0] == '-' && arg != "-") {
+			cout << "Error: Unrecognized option '" << arg << "'.\n\n";
+			printUsage();
+			return EXIT_FAILURE;
+		} else if(convert && !input_path.empty()) {
+			output_path = arg;
+		} else {
+			input_path = arg;
+		}
+	}
+
+	if(convert) {
+		if(input_path.empty() || output_path.empty()) {
+			cout << "Error: --convert needs an input and an output path.\n\n";
+			return EXIT_FAILURE;
+		}
+		return runConvert(input_path, output_path, indexed);
+	}
+
+	if(!GridPuzzle::isSupportedSide(side)) {
+		cout << "Error: Unsupported grid size " << side << ".\n\n";
 		return EXIT_FAILURE;
 	}
 
-	//Store the path to the input file
-	input_path = argv[1];
+	if(generate >= 0) {
+		generator.setThreads(threads);
+		return runGenerator(generator, generate);
+	}
+	//A cache file with no capacity given gets a default one
+	SolutionCache cache((cache_capacity > 0) ? cache_capacity : DEFAULT_CACHE_CAPACITY);
+	bool caching = cache_capacity > 0 || !cache_path.empty();
+	if(caching) {
+		if(!cache_path.empty()) {
+			cache.load(cache_path);
+		}
+		configuration.setCache(&cache);
+	}
+	if(serve || batch) {
+		int status = serve ? runServer(configuration, threads, socket_path, timeout_ms / 1000.0, max_nodes) :
+					 runBatch(input_path.empty() ? "-" : input_path, configuration, threads, statistics,
+							  binary_output, side);
+		if(caching && !cache_path.empty() && !cache.save(cache_path)) {
+			cerr << "Error: Unable to write the cache to '" << cache_path << "'.\n";
+		}
+		return status;
+	}
+
+	if(input_path.empty()) {
+		cout << "Error: Missing input filename.\n\n";
+		return EXIT_FAILURE;
+	}
 
 	//Parse the file's contents, storing the unsolved state in a single string
-	//with all whitespace removed
-	input_handle.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-	try {
-		//Default flag is 'ios::in' for ifstream
-		input_handle.open(input_path.c_str());
-		if(input_handle.is_open()) {
-			//Assign the file's text contents to the string
-			while(input_handle.good()) {
-				string line;
-				getline(input_handle, line);
-				state += line;
-			}
-			input_handle.close();
+	//(with all whitespace removed, for 9x9 grids)
+	//Default flag is 'ios::in' for ifstream
+	input_handle.open(input_path.c_str());
+	if(!input_handle.is_open()) {
+		cerr << "Error: Unable to open '" << input_path << "'.\n\n";
+		return EXIT_FAILURE;
+	}
+	//Assign the file's text contents to the string, one line at a time
+	string line;
+	while(getline(input_handle, line)) {
+		state += line;
+		state += '\n';
+	}
+	input_handle.close();
+
+	if(side != 9) {
+		//Grids other than 9x9 keep their whitespace, which separates multi-digit cells
+		GridPuzzle grid(GridPuzzle::getBoxSizeOfSide(side));
+		if(!grid.setState(state)) {
+			cout << "Error: '" << input_path << "' does not hold a " << side << "x" << side << " grid.\n\n";
+			return EXIT_FAILURE;
 		}
-	} catch(const ifstream::failure e) {
-		throw runtime_error("\nException occurred when opening or reading a file.\n");
+		grid.printCurrentBoard();
+		if(grid.solve()) {
+			cout << "\nSolution found!\n";
+			grid.printCurrentBoard();
+		} else {
+			cout << "\nNo solution found!\n";
+		}
+		if(statistics) {
+			printStats(grid.getStats());
+		}
+		return EXIT_SUCCESS;
 	}
 
 	state = Utilities::stripWhitespaces(state);
 
-	Sudoku s(state);
+	//Malformed text is turned away before it is parsed
+	Triage triage;
+	string reason;
+	if(!triage.checkText(state.data(), state.size())) {
+		triage.describe(reason);
+		cout << "Error: '" << input_path << "' does not hold a puzzle (" << reason << ").\n\n";
+		return EXIT_FAILURE;
+	}
+
+	Sudoku s(configuration);
+	s.setState(state);
+	s.setThreads(threads);
 
 	//Print the state that was initially provided
 	s.printCurrentBoard();
 
-	//Attempt to solve the game. If it is solvable, print the solution.
-	//If the game is unsolvable, print a message to let the user know.
-	if(s.solve()) {
+	//Attempt to solve the game, within the budget given (if any). If it is solvable,
+	//print the solution. If the game is unsolvable, print a message to let the user know.
+	SearchLimits limits;
+	if(timeout_ms > 0) {
+		limits.setTimeout(timeout_ms / 1000.0);
+	}
+	limits.setMaxNodes(max_nodes);
+	Sudoku::Result result = s.solve(limits);
+	if(result == Sudoku::SOLVED) {
 		cout << "\nSolution found!\n";
 		s.printCurrentBoard();
+	} else if(result == Sudoku::BUDGET_EXHAUSTED) {
+		cout << "\nSearch budget exhausted before a solution was found!\n";
+	} else if(s.getTriageResult().isRejected()) {
+		s.getTriageResult().describe(reason);
+		cout << "\nNo solution found! Rejected before searching: " << reason << ".\n";
 	} else {
 		cout << "\nNo solution found!\n";
 	}
+	if(statistics) {
+		printStats(s.getStats());
+	}
+	if(caching && !cache_path.empty() && !cache.save(cache_path)) {
+		cerr << "Error: Unable to write the cache to '" << cache_path << "'.\n";
+	}
 
 	return EXIT_SUCCESS;
 
@@ -0,0 +1,230 @@
+/**
+ * @file AllocationTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains tests checking that steady-state solving makes no heap allocations: once a
+ * solver (or server) has warmed up, solving further puzzles must not touch the global
+ * allocator, whose lock would otherwise limit how well the service scales.
+ *
+ * The test runner is built as a single translation unit, so this header can replace
+ * the global operator new and delete for the whole runner. The replacements count
+ * every allocation, both overall and per thread, and otherwise defer to malloc.
+ */
+
+#ifndef ALLOCATION_TEST_H
+#define ALLOCATION_TEST_H
+
+//Protected includes
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/Sudoku.h"
+#include "../lib/BatchSolver.h"
+#include "../lib/SolverServer.h"
+#include "../lib/SolutionIterator.h"
+
+using namespace std;
+
+//Allocations made through the global operator new, by every thread and by this one
+struct AllocationHook {
+
+	static inline atomic<long> total{0};
+	static inline thread_local long local = 0;
+
+};
+
+void* operator new(size_t size) {
+	AllocationHook::total.fetch_add(1, memory_order_relaxed);
+	AllocationHook::local++;
+	void* memory = malloc((size > 0) ? size : 1);
+	if(memory == NULL) {
+		throw bad_alloc();
+	}
+	return memory;
+}
+
+void* operator new[](size_t size) {
+	return operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+	free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+	free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+	free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept {
+	free(memory);
+}
+
+class AllocationTest : public CxxTest::TestSuite {
+
+private:
+
+	static const char* const PUZZLES[];
+	static const int PUZZLE_COUNT;
+
+	//Solves every puzzle with a Sudoku object, returning the allocations it made
+	static long solveAll(Sudoku& sudoku, const SearchLimits& limits) {
+		long before = AllocationHook::local;
+		for(int i = 0; i < PUZZLE_COUNT; i++) {
+			sudoku.setState(PUZZLES[i], 81);
+			sudoku.solve(limits);
+		}
+		return AllocationHook::local - before;
+	}
+
+	//Serves every puzzle some number of times over one connection, returning the allocations made by any thread
+	static long serveRepeated(SolverServer& server, int repeats) {
+		string requests;
+		for(int round = 0; round < repeats; round++) {
+			for(int i = 0; i < PUZZLE_COUNT; i++) {
+				requests += "request-with-a-long-id-" + to_string(i) + " " + PUZZLES[i] + "\n";
+			}
+		}
+		//Everything fits in the pipes' buffers, so nothing else needs to run meanwhile
+		int input[2];
+		int output[2];
+		TS_ASSERT_EQUALS(pipe(input), 0);
+		TS_ASSERT_EQUALS(pipe(output), 0);
+		TS_ASSERT_EQUALS(write(input[1], requests.data(), requests.size()), (ssize_t)requests.size());
+		close(input[1]);
+		long before = AllocationHook::total;
+		server.serve(input[0], output[1]);
+		long allocations = AllocationHook::total - before;
+		close(input[0]);
+		close(output[1]);
+		char buffer[65536];
+		TS_ASSERT(read(output[0], buffer, sizeof(buffer)) > 0);
+		close(output[0]);
+		return allocations;
+	}
+
+public:
+
+	void testHookCounts() {
+		long before = AllocationHook::local;
+		vector<int> values(100);
+		values[0] = 1;
+		TS_ASSERT_EQUALS(AllocationHook::local - before, 1);
+		TS_ASSERT_EQUALS(values[0], 1);
+	}
+
+	void testSolveMakesNoAllocations() {
+		SearchLimits none;
+		SearchLimits limited;
+		limited.setTimeout(60);
+		limited.setMaxNodes(100000000);
+		Sudoku backtracking("");
+		backtracking.setPropagation(true);
+		backtracking.setCellOrder(Backtracker::MINIMUM_REMAINING_VALUES);
+		Sudoku plain("");
+		Sudoku dancing_links("", Sudoku::DANCING_LINKS);
+		Sudoku templates("", Sudoku::TEMPLATES);
+		Sudoku* solvers[] = {&backtracking, &plain, &dancing_links, &templates};
+		for(int k = 0; k < 4; k++) {
+			solveAll(*solvers[k], none);
+			TS_ASSERT_EQUALS(solveAll(*solvers[k], none), 0);
+			TS_ASSERT_EQUALS(solveAll(*solvers[k], limited), 0);
+		}
+	}
+
+	void testBatchLinesMakeNoAllocations() {
+		Sudoku sudoku("");
+		sudoku.setPropagation(true);
+		string output;
+		BatchSummary summary;
+		for(int round = 0; round < 2; round++) {
+			long before = AllocationHook::local;
+			for(int i = 0; i < PUZZLE_COUNT; i++) {
+				output.clear();
+				BatchSolver::solveLine(sudoku, PUZZLES[i], 81, output, summary, true);
+			}
+			if(round == 1) {
+				TS_ASSERT_EQUALS(AllocationHook::local - before, 0);
+			}
+		}
+	}
+
+	void testEditingMakesNoAllocations() {
+		Sudoku sudoku(PUZZLES[0]);
+		sudoku.setPropagation(true);
+		int index = -1;
+		int digit = 0;
+		for(int round = 0; round < 2; round++) {
+			long before = AllocationHook::local;
+			sudoku.setState(PUZZLES[0], 81);
+			while(sudoku.getHint(index, digit)) {
+				sudoku.setCell(index, digit);
+			}
+			while(sudoku.undo()) {
+			}
+			if(round == 1) {
+				TS_ASSERT_EQUALS(AllocationHook::local - before, 0);
+			}
+		}
+	}
+
+	void testIteratorMakesNoAllocations() {
+		Sudoku sudoku("87.39.........85.9....5.1...2.1..3.44.3...2.56.8..4.9...2.4....7........5...17.4.");
+		long before = AllocationHook::local;
+		SolutionIterator<3> solutions = sudoku.getSolutionIterator();
+		SearchLimits slice;
+		slice.setMaxNodes(5);
+		while(solutions.next(slice) != SolutionIterator<3>::FINISHED) {
+		}
+		TS_ASSERT_EQUALS(AllocationHook::local - before, 0);
+		TS_ASSERT_EQUALS(solutions.getSolutions(), 24);
+	}
+
+	void testServerMakesNoAllocations() {
+		Sudoku configuration("");
+		configuration.setPropagation(true);
+		SolverServer server(configuration, 2);
+		server.setMaxNodes(1000000);
+		long few = 0;
+		long many = 0;
+		//Warms the server up, then serves a short and a long connection alike
+		for(int round = 0; round < 4; round++) {
+			long allocations = serveRepeated(server, (round == 2) ? 1 : 40);
+			if(round == 2) {
+				few = allocations;
+			} else if(round == 3) {
+				many = allocations;
+			}
+		}
+		//A connection's own line buffers are all it allocates, however many requests it carries
+		TS_ASSERT_EQUALS(few, many);
+		TS_ASSERT(many <= 2);
+		TS_ASSERT(server.getPooledRequests() <= (size_t)(40 * PUZZLE_COUNT));
+		TS_ASSERT_EQUALS(server.getRequests(), 121 * PUZZLE_COUNT);
+	}
+
+};
+
+const char* const AllocationTest::PUZZLES[] = {
+	"4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......",
+	"52...6.........7.13...........4..8..6......5...........418.........3..2...87.....",
+	"6.....8.3.4.7.................5.4.7.3..2.....1.6.......2.....5.....8.6......1....",
+	"48.3............71.2.......7.5....6....2..8.............1.76...3.....4......5....",
+	"1.657..9.84..2.1...5.9.4...6.....2.3.82.9.74.4.7.....1...4.2.1...5.8..39.7..598.4",
+	"..3.2.6..9..3.5..1..18.64....81.29..7.......8..67.82....26.95..8..2.3..9..5.1.3.."
+};
+
+const int AllocationTest::PUZZLE_COUNT = 6;
+
+#endif
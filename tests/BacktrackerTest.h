@@ -0,0 +1,217 @@
+/**
+ * @file BacktrackerTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the Backtracker class.
+ */
+
+#ifndef BACKTRACKER_TEST_H
+#define BACKTRACKER_TEST_H
+
+//Protected includes
+#include <string>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/Backtracker.h"
+#include "../lib/Sudoku.h"
+
+using namespace std;
+
+class BacktrackerTest : public CxxTest::TestSuite {
+
+public:
+
+	void testSolveInPlace() {
+		string state = "87.39...."
+					   ".....85.9"
+					   "....5.1.."
+					   ".2.1..3.4"
+					   "4.3...2.5"
+					   "6.8..4.9."
+					   "..2.4...."
+					   "7........"
+					   "5...17.4.";
+		Sudoku s(state);
+		Backtracker b;
+		TS_ASSERT(b.load(s.getStartingBoard()));
+		TS_ASSERT(b.solve());
+		vector<int> solution;
+		b.getBoard(solution);
+		TS_ASSERT_EQUALS(solution.size(), 81);
+		TS_ASSERT_EQUALS(solution[0], 8);
+		Candidates used;
+		TS_ASSERT(used.load(solution));
+		for(int i = 0; i < 81; i++) {
+			TS_ASSERT(solution[i] >= 1 && solution[i] <= 9);
+		}
+	}
+
+	void testFailedSearchRestoresBoard() {
+		string state = "1.657..9."
+					   "84..2.1.."
+					   ".5.9.4..."
+					   "6.....2.3"
+					   ".82.9.74."
+					   "4.7.....1"
+					   "...4.2.1."
+					   "..5.8..39"
+					   ".7..598.4";
+		Sudoku s(state);
+		Backtracker b;
+		TS_ASSERT(b.load(s.getStartingBoard()));
+		TS_ASSERT(!b.solve());
+		vector<int> board;
+		b.getBoard(board);
+		TS_ASSERT(board == s.getStartingBoard());
+	}
+
+	void testPropagationSolvesWithoutSearch() {
+		//Every missing value here can be deduced from singles alone
+		string state = "..3.2.6.."
+					   "9..3.5..1"
+					   "..18.64.."
+					   "..81.29.."
+					   "7.......8"
+					   "..67.82.."
+					   "..26.95.."
+					   "8..2.3..9"
+					   "..5.1.3..";
+		Sudoku s(state);
+		//Triage would fill the singles before the search could
+		s.setTriage(false);
+		s.setPropagation(true);
+		TS_ASSERT(s.getPropagation());
+		TS_ASSERT(s.solve());
+		TS_ASSERT(s.isComplete());
+		int missing = 0;
+		vector<int> start = s.getStartingBoard();
+		for(int i = 0; i < 81; i++) {
+			if(start[i] == -1) {
+				missing++;
+			}
+		}
+		TS_ASSERT_EQUALS(s.getStats().getPropagatedCells(), missing);
+	}
+
+	void testPropagationMatchesPlainSearch() {
+		string state = "4.....8.5"
+					   ".3......."
+					   "...7....."
+					   ".2.....6."
+					   "....8.4.."
+					   "....1...."
+					   "...6.3.7."
+					   "5..2....."
+					   "1.4......";
+		Sudoku plain(state);
+		Sudoku propagated(state);
+		propagated.setPropagation(true);
+		TS_ASSERT(plain.solve());
+		TS_ASSERT(propagated.solve());
+		TS_ASSERT(plain.getCurrentBoard() == propagated.getCurrentBoard());
+		TS_ASSERT_LESS_THAN(0, propagated.getStats().locked_candidates);
+
+		string unsolvable = "1.657..9."
+							"84..2.1.."
+							".5.9.4..."
+							"6.....2.3"
+							".82.9.74."
+							"4.7.....1"
+							"...4.2.1."
+							"..5.8..39"
+							".7..598.4";
+		Sudoku s(unsolvable);
+		s.setPropagation(true);
+		TS_ASSERT(!s.solve());
+		TS_ASSERT(s.getCurrentBoard() == s.getStartingBoard());
+	}
+
+	void testHeuristicsReduceNodes() {
+		string state = "........."
+					   ".....3.85"
+					   "..1.2...."
+					   "...5.7..."
+					   "..4...1.."
+					   ".9......."
+					   "5......73"
+					   "..2.1...."
+					   "....4...9";
+		//Compare the searches themselves, without the singles triage fills first
+		Sudoku first_empty(state);
+		first_empty.setTriage(false);
+		TS_ASSERT(first_empty.solve());
+
+		Sudoku mrv(state);
+		mrv.setTriage(false);
+		mrv.setCellOrder(Backtracker::MINIMUM_REMAINING_VALUES);
+		mrv.setValueOrder(Backtracker::LEAST_CONSTRAINING);
+		TS_ASSERT_EQUALS(mrv.getCellOrder(), Backtracker::MINIMUM_REMAINING_VALUES);
+		TS_ASSERT_EQUALS(mrv.getValueOrder(), Backtracker::LEAST_CONSTRAINING);
+		TS_ASSERT(mrv.solve());
+		TS_ASSERT(mrv.getCurrentBoard() == first_empty.getCurrentBoard());
+		TS_ASSERT_LESS_THAN(mrv.getStats().nodes, first_empty.getStats().nodes);
+	}
+
+	void testSearchStats() {
+		string state = "87.39...."
+					   ".....85.9"
+					   "....5.1.."
+					   ".2.1..3.4"
+					   "4.3...2.5"
+					   "6.8..4.9."
+					   "..2.4...."
+					   "7........"
+					   "5...17.4.";
+		Sudoku s(state);
+		//Count every missing cell as the search's to fill
+		s.setTriage(false);
+		TS_ASSERT(s.solve());
+		const SearchStats& stats = s.getStats();
+		TS_ASSERT_LESS_THAN(0, stats.nodes);
+#if SEARCH_STATS
+		//Every digit tried is either on the path to the solution or was backed out of
+		int missing = 0;
+		for(int i = 0; i < 81; i++) {
+			missing += (s.getStartingBoard()[i] == -1) ? 1 : 0;
+		}
+		TS_ASSERT_LESS_THAN(0, stats.branches);
+		TS_ASSERT_LESS_THAN_EQUALS(stats.branches, stats.candidates_tried);
+		TS_ASSERT_EQUALS(stats.candidates_tried - stats.backtracks, missing);
+		TS_ASSERT_EQUALS(stats.max_depth, missing);
+		TS_ASSERT_EQUALS(stats.nodes, stats.candidates_tried + 1);
+		TS_ASSERT_LESS_THAN_EQUALS(1.0, stats.getCandidatesPerBranch());
+		TS_ASSERT_LESS_THAN(0, stats.search_seconds);
+
+		//With propagation, the search runs out of places to branch much sooner
+		Sudoku propagated(state);
+		propagated.setPropagation(true);
+		TS_ASSERT(propagated.countSolutions() == 24);
+		TS_ASSERT_LESS_THAN(0, propagated.getStats().propagation_seconds);
+		TS_ASSERT_LESS_THAN(propagated.getStats().max_depth, missing);
+
+		//Several threads add up their counters
+		Sudoku parallel(state);
+		parallel.setThreads(2);
+		TS_ASSERT(parallel.countSolutions() == 24);
+		Sudoku sequential(state);
+		TS_ASSERT(sequential.countSolutions() == 24);
+		TS_ASSERT_EQUALS(parallel.getStats().max_depth, sequential.getStats().max_depth);
+#endif
+	}
+
+	void testLoadRejectsConflicts() {
+		vector<int> state(81, -1);
+		state[0] = 4;
+		state[80] = 4;
+		Backtracker b;
+		TS_ASSERT(b.load(state));
+		state[1] = 4;
+		TS_ASSERT(!b.load(state));
+	}
+
+};
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * @file BatchSolverTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the BatchSolver class.
+ */
+
+#ifndef BATCH_SOLVER_TEST_H
+#define BATCH_SOLVER_TEST_H
+
+//Protected includes
+#include <string>
+#include <sstream>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/BatchSolver.h"
+#include "../lib/Sudoku.h"
+
+using namespace std;
+
+class BatchSolverTest : public CxxTest::TestSuite {
+
+public:
+
+	void testRun() {
+		stringstream input;
+		input << "# A comment, followed by a blank line\n"
+				 "\n"
+				 "023456789456789123789123456234567891567891234891234567345678912678912345912345670\n"
+				 "1.657..9.84..2.1...5.9.4...6.....2.3.82.9.74.4.7.....1...4.2.1...5.8..39.7..598.4\r\n"
+				 "12345\n"
+				 "x23456789456789123789123456234567891567891234891234567345678912678912345912345678\n";
+		stringstream output;
+		BatchSolver batch(Sudoku("", Sudoku::DANCING_LINKS));
+		BatchSummary summary = batch.run(input, output);
+		TS_ASSERT_EQUALS(summary.puzzles, 4);
+		TS_ASSERT_EQUALS(summary.solved, 1);
+		TS_ASSERT_EQUALS(summary.unsolvable, 1);
+		TS_ASSERT_EQUALS(summary.invalid, 2);
+		TS_ASSERT_EQUALS(output.str(),
+			"123456789456789123789123456234567891567891234891234567345678912678912345912345678\n"
+			"unsolvable\n"
+			"invalid\n"
+			"invalid\n");
+	}
+
+	void testStatistics() {
+		stringstream input;
+		input << "023456789456789123789123456234567891567891234891234567345678912678912345912345670\n"
+				 "12345\n";
+		stringstream output;
+		BatchSolver batch(Sudoku(""));
+		TS_ASSERT(!batch.getStatistics());
+		batch.setStatistics(true);
+		BatchSummary summary = batch.run(input, output);
+		//Triage fills both missing cells, so the search only has to confirm the board
+		TS_ASSERT_EQUALS(summary.stats.nodes, 1);
+		string solved;
+		string invalid;
+		getline(output, solved);
+		getline(output, invalid);
+		TS_ASSERT_EQUALS(solved.substr(0, 90),
+			"123456789456789123789123456234567891567891234891234567345678912678912345912345678\tnodes=1 ");
+		TS_ASSERT(solved.find(" search_us=") != string::npos);
+		TS_ASSERT_EQUALS(invalid, "invalid");
+	}
+
+	void testRunParallelKeepsInputOrder() {
+		string puzzles[3] = {
+			"1.657..9.84..2.1...5.9.4...6.....2.3.82.9.74.4.7.....1...4.2.1...5.8..39.7..598.4",
+			"..3.2.6..9..3.5..1..18.64....81.29..7.......8..67.82....26.95..8..2.3..9..5.1.3..",
+			"4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......"
+		};
+		//Enough puzzles for several chunks, so they finish out of order
+		stringstream input;
+		int count = BatchSolver::CHUNK_SIZE * 10 + 7;
+		for(int i = 0; i < count; i++) {
+			input << puzzles[i % 3] << "\n";
+		}
+		string sequential_input = input.str();
+
+		stringstream parallel_output;
+		BatchSolver parallel(Sudoku("", Sudoku::DANCING_LINKS), 4);
+		TS_ASSERT_EQUALS(parallel.getThreads(), 4);
+		BatchSummary summary = parallel.run(input, parallel_output);
+		TS_ASSERT_EQUALS(summary.puzzles, count);
+		TS_ASSERT_EQUALS(summary.unsolvable, (count + 2) / 3);
+
+		stringstream sequential(sequential_input);
+		stringstream sequential_output;
+		BatchSolver(Sudoku("", Sudoku::DANCING_LINKS)).run(sequential, sequential_output);
+		TS_ASSERT_EQUALS(parallel_output.str(), sequential_output.str());
+	}
+
+	void testIsPuzzleLine() {
+		string line(81, '.');
+		TS_ASSERT(BatchSolver::isPuzzleLine(line));
+		line[40] = '0';
+		TS_ASSERT(BatchSolver::isPuzzleLine(line));
+		line[40] = '-';
+		TS_ASSERT(!BatchSolver::isPuzzleLine(line));
+		TS_ASSERT(!BatchSolver::isPuzzleLine(string(80, '.')));
+	}
+
+};
+
+#endif
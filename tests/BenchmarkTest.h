@@ -0,0 +1,109 @@
+/**
+ * @file BenchmarkTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the Benchmark class.
+ */
+
+#ifndef BENCHMARK_TEST_H
+#define BENCHMARK_TEST_H
+
+//Protected includes
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/Benchmark.h"
+
+using namespace std;
+
+class BenchmarkTest : public CxxTest::TestSuite {
+
+public:
+
+	void testPercentile() {
+		vector<double> empty;
+		TS_ASSERT_EQUALS(Benchmark::getPercentile(empty, 0.5), 0);
+		vector<double> samples;
+		for(int i = 1; i <= 100; i++) {
+			samples.push_back(i);
+		}
+		TS_ASSERT_EQUALS(Benchmark::getPercentile(samples, 0.50), 50);
+		TS_ASSERT_EQUALS(Benchmark::getPercentile(samples, 0.99), 99);
+		TS_ASSERT_EQUALS(Benchmark::getPercentile(samples, 1.0), 100);
+		TS_ASSERT_EQUALS(Benchmark::getPercentile(samples, 0.0), 1);
+		vector<double> single(1, 7.5);
+		TS_ASSERT_EQUALS(Benchmark::getPercentile(single, 0.99), 7.5);
+	}
+
+	void testCorpusName() {
+		TS_ASSERT_EQUALS(Benchmark::getCorpusName("bench/corpora/hard.txt"), "hard");
+		TS_ASSERT_EQUALS(Benchmark::getCorpusName("easy"), "easy");
+		TS_ASSERT_EQUALS(Benchmark::getCorpusName("/tmp/.hidden"), ".hidden");
+	}
+
+	void testRunCorpus() {
+		vector<string> puzzles;
+		//One solvable, one unsolvable (state3), and one malformed line
+		puzzles.push_back(".........456789123789123456234567891567891234891234567345678912678912345912345678");
+		puzzles.push_back("1.657..9.84..2.1...5.9.4...6.....2.3.82.9.74.4.7.....1...4.2.1...5.8..39.7..598.4");
+		puzzles.push_back("12345");
+		Benchmark benchmark;
+		benchmark.addDefaultConfigurations();
+		benchmark.setRepeat(2);
+		benchmark.runCorpus("mixed", puzzles);
+		const vector<BenchmarkResult>& results = benchmark.getResults();
+		TS_ASSERT_EQUALS(results.size(), benchmark.getConfigurations().size());
+		for(int i = 0; i < results.size(); i++) {
+			TS_ASSERT_EQUALS(results[i].corpus, "mixed");
+			TS_ASSERT_EQUALS(results[i].configuration, benchmark.getConfigurations()[i].name);
+			TS_ASSERT_EQUALS(results[i].puzzles, 3);
+			TS_ASSERT_EQUALS(results[i].solved, 1);
+			TS_ASSERT_EQUALS(results[i].unsolvable, 1);
+			TS_ASSERT_EQUALS(results[i].invalid, 1);
+			TS_ASSERT_EQUALS(results[i].runs, 4);
+			TS_ASSERT(results[i].nodes_per_puzzle > 0);
+			TS_ASSERT(results[i].p50_latency <= results[i].p99_latency);
+			TS_ASSERT(results[i].p99_latency <= results[i].max_latency);
+			TS_ASSERT(results[i].peak_rss > 0);
+		}
+	}
+
+	void testSelectConfigurations() {
+		Benchmark benchmark;
+		benchmark.addDefaultConfigurations();
+		vector<string> names;
+		names.push_back("dlx");
+		names.push_back("unknown");
+		TS_ASSERT(!benchmark.selectConfigurations(names));
+		names.pop_back();
+		names.push_back("mrv");
+		TS_ASSERT(benchmark.selectConfigurations(names));
+		TS_ASSERT_EQUALS(benchmark.getConfigurations().size(), 2);
+		TS_ASSERT_EQUALS(benchmark.getConfigurations()[0].name, "dlx");
+		TS_ASSERT_EQUALS(benchmark.getConfigurations()[1].name, "mrv");
+	}
+
+	void testJson() {
+		vector<string> puzzles(1, ".........456789123789123456234567891567891234891234567345678912678912345912345678");
+		Benchmark benchmark;
+		benchmark.addConfiguration("quoted\"name", Sudoku(""));
+		benchmark.runCorpus("easy", puzzles);
+		ostringstream json;
+		benchmark.writeJson(json);
+		string text = json.str();
+		TS_ASSERT(text.find("\"corpus\": \"easy\"") != string::npos);
+		TS_ASSERT(text.find("\"configuration\": \"quoted\\\"name\"") != string::npos);
+		TS_ASSERT(text.find("\"latency_us\": {\"mean\": ") != string::npos);
+		TS_ASSERT(text.find("\"peak_rss_kb\": ") != string::npos);
+		ostringstream table;
+		benchmark.writeTable(table);
+		TS_ASSERT(table.str().find("easy") != string::npos);
+	}
+
+};
+
+#endif
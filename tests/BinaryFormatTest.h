@@ -0,0 +1,208 @@
+/**
+ * @file BinaryFormatTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the binary corpus format: the BinaryFormat, BinaryWriter, and
+ * BinaryPuzzleReader classes, and binary batches.
+ */
+
+#ifndef BINARY_FORMAT_TEST_H
+#define BINARY_FORMAT_TEST_H
+
+//Protected includes
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/BinaryFormat.h"
+#include "../lib/BatchSolver.h"
+#include "../lib/Sudoku.h"
+
+using namespace std;
+
+class BinaryFormatTest : public CxxTest::TestSuite {
+
+private:
+
+	static const string PUZZLE;
+	static const string SOLUTION;
+
+	//A file of its own for each test, so that concurrent runs never share one
+	string path;
+
+	string writeFile(const string& contents) {
+		ofstream file(this->path.c_str(), ios::binary | ios::trunc);
+		file << contents;
+		return this->path;
+	}
+
+public:
+
+	void setUp() {
+		char name[] = "/tmp/BinaryFormatTest.XXXXXX";
+		int descriptor = mkstemp(name);
+		TS_ASSERT(descriptor >= 0);
+		close(descriptor);
+		this->path = name;
+	}
+
+	void tearDown() {
+		unlink(this->path.c_str());
+	}
+
+	void testRecords() {
+		Board puzzle;
+		Board solution;
+		puzzle.parse(PUZZLE.data(), 81);
+		solution.parse(SOLUTION.data(), 81);
+		uint8_t record[BinaryFormat::PUZZLE_RECORD_SIZE];
+		BinaryFormat::encodePuzzle(puzzle, solution, BinaryFormat::SOLVED, record);
+		Board decoded;
+		Board decoded_solution;
+		TS_ASSERT_EQUALS(BinaryFormat::decodePuzzle(record, decoded, decoded_solution), BinaryFormat::SOLVED);
+		TS_ASSERT(decoded == puzzle);
+		TS_ASSERT(decoded_solution == solution);
+		//Without a solution, only the givens are stored
+		BinaryFormat::encodePuzzle(puzzle, solution, BinaryFormat::UNSOLVED, record);
+		TS_ASSERT_EQUALS(BinaryFormat::decodePuzzle(record, decoded, decoded_solution), BinaryFormat::UNSOLVED);
+		TS_ASSERT(decoded == puzzle);
+		TS_ASSERT(decoded_solution == puzzle);
+		BinaryFormat::encodeSolution(solution, BinaryFormat::UNSOLVABLE, record);
+		TS_ASSERT_EQUALS(BinaryFormat::decodeSolution(record, decoded_solution), BinaryFormat::UNSOLVABLE);
+		TS_ASSERT(decoded_solution == Board());
+		TS_ASSERT_EQUALS(BinaryFormat::PUZZLE_RECORD_SIZE, 52);
+		TS_ASSERT_EQUALS(BinaryFormat::SOLUTION_RECORD_SIZE, 41);
+	}
+
+	void testHeader() {
+		BinaryHeader header;
+		header.kind = BinaryFormat::SOLUTIONS;
+		header.record_size = BinaryFormat::SOLUTION_RECORD_SIZE;
+		header.count = 123456789012ull;
+		uint8_t bytes[BinaryFormat::HEADER_SIZE];
+		header.encode(bytes);
+		TS_ASSERT(BinaryFormat::isBinary((const char*)bytes, sizeof(bytes)));
+		BinaryHeader decoded;
+		TS_ASSERT(decoded.decode(bytes, sizeof(bytes)));
+		TS_ASSERT_EQUALS(decoded.kind, BinaryFormat::SOLUTIONS);
+		TS_ASSERT_EQUALS(decoded.count, 123456789012ull);
+		//A record size that doesn't match the kind is rejected
+		bytes[8] = 7;
+		TS_ASSERT(!decoded.decode(bytes, sizeof(bytes)));
+		TS_ASSERT(!decoded.decode(bytes, 10));
+	}
+
+	void testConvertAndRead() {
+		stringstream text;
+		text << "# comment\n" << PUZZLE << "\n\n" << "12345\n" << PUZZLE << "\r\n";
+		stringstream binary;
+		TS_ASSERT_EQUALS(BinaryFormat::convertToBinary(text, binary, true), 3);
+		TS_ASSERT_EQUALS(binary.str().size(), BinaryFormat::HEADER_SIZE + (3 * 52) + (3 * 8));
+		string path = writeFile(binary.str());
+		TS_ASSERT(BinaryFormat::isBinaryFile(path));
+		BinaryPuzzleReader reader;
+		TS_ASSERT(reader.open(path));
+		TS_ASSERT_EQUALS(reader.getKind(), BinaryFormat::PUZZLES);
+		TS_ASSERT_EQUALS(reader.getCount(), 3);
+		TS_ASSERT(reader.hasIndex());
+		TS_ASSERT_EQUALS(reader.getLine(0), 2);
+		TS_ASSERT_EQUALS(reader.getLine(1), 4);
+		TS_ASSERT_EQUALS(reader.getLine(2), 5);
+		//Records are addressed directly
+		reader.seek(2);
+		PuzzleView view;
+		string storage;
+		TS_ASSERT(reader.next(view, storage));
+		//The record is handed out as the board it decodes to, never as text
+		Board expected;
+		expected.parse(PUZZLE.data(), PUZZLE.size());
+		TS_ASSERT(view.decoded);
+		TS_ASSERT(view.board == expected);
+		TS_ASSERT(!reader.next(view, storage));
+		reader.seek(0);
+		stringstream back;
+		TS_ASSERT_EQUALS(BinaryPuzzleReader::convertToText(reader, back), 3);
+		TS_ASSERT_EQUALS(back.str(), PUZZLE + "\ninvalid\n" + PUZZLE + "\n");
+		reader.close();
+		remove(path.c_str());
+		TS_ASSERT(!reader.open(path));
+	}
+
+	void testCorruptIndex() {
+		stringstream text;
+		text << PUZZLE << "\n";
+		stringstream binary;
+		TS_ASSERT_EQUALS(BinaryFormat::convertToBinary(text, binary, true), 1);
+		string contents = binary.str();
+		//Claim an index inside the header, and more records than there could ever be
+		BinaryHeader header;
+		TS_ASSERT(header.decode((const uint8_t*)contents.data(), contents.size()));
+		header.count = BinaryFormat::UNKNOWN_COUNT - 1;
+		uint64_t offsets[] = {0, BinaryFormat::HEADER_SIZE - 1, contents.size() + 1, contents.size() - 4};
+		for(int i = 0; i < 4; i++) {
+			header.flags = BinaryFormat::HAS_INDEX;
+			header.index_offset = offsets[i];
+			header.encode((uint8_t*)&contents[0]);
+			string path = writeFile(contents);
+			//The index is ignored, and only the whole records in the file are read
+			BinaryPuzzleReader reader;
+			TS_ASSERT(reader.open(path));
+			TS_ASSERT(!reader.hasIndex());
+			TS_ASSERT_EQUALS(reader.getCount(), 1);
+			stringstream back;
+			TS_ASSERT_EQUALS(BinaryPuzzleReader::convertToText(reader, back), 1);
+			TS_ASSERT_EQUALS(back.str(), PUZZLE + "\n");
+		}
+	}
+
+	void testBinaryBatch() {
+		stringstream text;
+		text << PUZZLE << "\nnot a puzzle\n" << PUZZLE << "\n";
+		stringstream binary;
+		BinaryFormat::convertToBinary(text, binary, false);
+		string path = writeFile(binary.str());
+		BinaryPuzzleReader reader;
+		TS_ASSERT(reader.open(path));
+		TS_ASSERT(!reader.hasIndex());
+		Sudoku sudoku("");
+		BatchSolver batch(sudoku, 2);
+		batch.setBinaryOutput(true);
+		stringstream output;
+		BatchSummary summary = batch.run(reader, output);
+		TS_ASSERT_EQUALS(summary.solved, 2);
+		TS_ASSERT_EQUALS(summary.invalid, 1);
+		TS_ASSERT_EQUALS(output.str().size(), BinaryFormat::HEADER_SIZE + (3 * 41));
+		//The header carries the final count
+		BinaryHeader header;
+		TS_ASSERT(header.decode((const uint8_t*)output.str().data(), output.str().size()));
+		TS_ASSERT_EQUALS(header.count, 3);
+		//Decoded boards are solved as they are, with text output too
+		reader.seek(0);
+		batch.setBinaryOutput(false);
+		stringstream lines;
+		summary = batch.run(reader, lines);
+		TS_ASSERT_EQUALS(summary.solved, 2);
+		TS_ASSERT_EQUALS(lines.str(), SOLUTION + "\ninvalid\n" + SOLUTION + "\n");
+		path = writeFile(output.str());
+		BinaryPuzzleReader solutions;
+		TS_ASSERT(solutions.open(path));
+		TS_ASSERT_EQUALS(solutions.getKind(), BinaryFormat::SOLUTIONS);
+		stringstream back;
+		BinaryPuzzleReader::convertToText(solutions, back);
+		TS_ASSERT_EQUALS(back.str(), SOLUTION + "\ninvalid\n" + SOLUTION + "\n");
+	}
+
+};
+
+const string BinaryFormatTest::PUZZLE =
+	"4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......";
+const string BinaryFormatTest::SOLUTION =
+	"417369825632158947958724316825437169791586432346912758289643571573291684164875293";
+
+#endif
@@ -0,0 +1,194 @@
+/**
+ * @file BoardEditorTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the BoardEditor class, and for the editing interface of the
+ * Sudoku class built on it.
+ */
+
+#ifndef BOARD_EDITOR_TEST_H
+#define BOARD_EDITOR_TEST_H
+
+//Protected includes
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/BoardEditor.h"
+#include "../lib/BoardKernels.h"
+#include "../lib/Sudoku.h"
+
+using namespace std;
+
+class BoardEditorTest : public CxxTest::TestSuite {
+
+private:
+
+	static const string PUZZLE;
+	static const string SOLUTION;
+
+	//Checks the editor's incremental state against a board rebuilt from scratch
+	static void checkAgainstRebuild(const BoardEditor& editor) {
+		BoardEditor rebuilt;
+		rebuilt.load(editor.getCells());
+		TS_ASSERT_EQUALS(editor.isValid(), BoardKernels::isValid(editor.getCells().data()));
+		TS_ASSERT_EQUALS(editor.getConflictCount(), rebuilt.getConflictCount());
+		TS_ASSERT_EQUALS(editor.hasDeadCell(), rebuilt.hasDeadCell());
+		for(int i = 0; i < 81; i++) {
+			TS_ASSERT_EQUALS(editor.getCandidates(i), rebuilt.getCandidates(i));
+			TS_ASSERT_EQUALS(editor.isConflicted(i), rebuilt.isConflicted(i));
+		}
+	}
+
+public:
+
+	void testConflictsAndCandidates() {
+		BoardEditor editor;
+		TS_ASSERT(editor.isValid());
+		TS_ASSERT_EQUALS(editor.getCandidates(0), 0x1FF);
+		editor.set(0, 5);
+		TS_ASSERT_EQUALS(editor.getCandidates(0), 0);
+		//Every peer loses the digit; other cells keep it
+		TS_ASSERT_EQUALS(editor.getCandidates(8), 0x1FF & ~0x10);
+		TS_ASSERT_EQUALS(editor.getCandidates(72), 0x1FF & ~0x10);
+		TS_ASSERT_EQUALS(editor.getCandidates(20), 0x1FF & ~0x10);
+		TS_ASSERT_EQUALS(editor.getCandidates(80), 0x1FF);
+		//Two fives in a row conflict; a third in the same column adds a third cell
+		editor.set(8, 5);
+		editor.set(72, 5);
+		TS_ASSERT(!editor.isValid());
+		vector<int> conflicts;
+		editor.getConflicts(conflicts);
+		TS_ASSERT_EQUALS(conflicts.size(), 3);
+		TS_ASSERT_EQUALS(conflicts[0], 0);
+		TS_ASSERT_EQUALS(conflicts[1], 8);
+		TS_ASSERT_EQUALS(conflicts[2], 72);
+		//Removing the shared cell resolves both conflicts
+		editor.set(0, 0);
+		TS_ASSERT(editor.isValid());
+		TS_ASSERT_EQUALS(editor.getConflictCount(), 0);
+		checkAgainstRebuild(editor);
+	}
+
+	void testUndo() {
+		Board board;
+		board.parse(PUZZLE.data(), PUZZLE.size());
+		BoardEditor editor;
+		editor.load(board);
+		editor.set(1, 1);
+		editor.set(1, 7);
+		editor.set(2, 4);
+		TS_ASSERT_EQUALS(editor.getHistorySize(), 3);
+		TS_ASSERT(!editor.isValid());
+		int index = -1;
+		TS_ASSERT(editor.undo(index));
+		TS_ASSERT_EQUALS(index, 2);
+		TS_ASSERT(editor.isValid());
+		TS_ASSERT(editor.undo(index));
+		TS_ASSERT_EQUALS(editor.get(1), 1);
+		TS_ASSERT(editor.undo(index));
+		TS_ASSERT(!editor.undo(index));
+		TS_ASSERT(editor.getCells() == board);
+		checkAgainstRebuild(editor);
+	}
+
+	void testRandomEditsMatchRebuild() {
+		srand(17);
+		BoardEditor editor;
+		for(int step = 0; step < 2000; step++) {
+			int index = -1;
+			if(rand() % 4 == 0) {
+				editor.undo(index);
+			} else {
+				editor.set(rand() % 81, rand() % 10);
+			}
+			if(step % 50 == 0) {
+				checkAgainstRebuild(editor);
+			}
+		}
+		checkAgainstRebuild(editor);
+	}
+
+	void testSolutionTracking() {
+		Board board;
+		board.parse(PUZZLE.data(), PUZZLE.size());
+		Board solution;
+		solution.parse(SOLUTION.data(), SOLUTION.size());
+		BoardEditor editor;
+		editor.load(board);
+		TS_ASSERT(!editor.agreesWithSolution());
+		editor.setSolution(solution);
+		TS_ASSERT(editor.agreesWithSolution());
+		editor.set(1, 2);
+		TS_ASSERT(!editor.agreesWithSolution());
+		editor.set(1, 1);
+		TS_ASSERT(editor.agreesWithSolution());
+	}
+
+	void testSudokuEditing() {
+		Sudoku s(PUZZLE);
+		//Givens can't be edited
+		TS_ASSERT(!s.setCell(0, 3));
+		TS_ASSERT(!s.clearCell(0));
+		TS_ASSERT(!s.setCell(1, 0));
+		TS_ASSERT(!s.undo());
+		TS_ASSERT(s.setCell(1, 4));
+		TS_ASSERT(!s.isValid());
+		vector<int> conflicts = s.getConflicts();
+		TS_ASSERT_EQUALS(conflicts.size(), 2);
+		TS_ASSERT_EQUALS(conflicts[0], 0);
+		TS_ASSERT_EQUALS(conflicts[1], 1);
+		TS_ASSERT(!s.isSolvable());
+		int index = -1;
+		int digit = 0;
+		TS_ASSERT(!s.getHint(index, digit));
+		TS_ASSERT(s.undo());
+		TS_ASSERT(s.isValid());
+		TS_ASSERT(s.getCurrentBoard() == s.getStartingBoard());
+		vector<int> candidates = s.getCandidates(1);
+		TS_ASSERT_EQUALS(candidates.size(), 4);
+		TS_ASSERT_EQUALS(candidates[0], 1);
+		TS_ASSERT(s.getCandidates(0).empty());
+	}
+
+	void testSudokuHints() {
+		Sudoku s(PUZZLE);
+		s.setPropagation(true);
+		TS_ASSERT(s.isSolvable());
+		//Following the hints completes the board with its solution
+		int index = -1;
+		int digit = 0;
+		int hints = 0;
+		while(s.getHint(index, digit)) {
+			TS_ASSERT_EQUALS(digit, SOLUTION[index] - '0');
+			TS_ASSERT(s.setCell(index, digit));
+			hints++;
+		}
+		TS_ASSERT_EQUALS(hints, 64);
+		TS_ASSERT(s.isComplete());
+		//A wrong digit that conflicts with nothing is only found out by the search
+		Sudoku s2(PUZZLE);
+		s2.setPropagation(true);
+		TS_ASSERT(s2.isSolvable());
+		TS_ASSERT(s2.setCell(1, 6));
+		TS_ASSERT(s2.isValid());
+		TS_ASSERT(!s2.isSolvable());
+		TS_ASSERT(s2.clearCell(1));
+		TS_ASSERT(s2.isSolvable());
+		//Replacing the board forgets the edits
+		TS_ASSERT(s2.setCell(1, 1));
+		s2.setState(PUZZLE);
+		TS_ASSERT(!s2.undo());
+	}
+
+};
+
+const string BoardEditorTest::PUZZLE =
+	"4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......";
+const string BoardEditorTest::SOLUTION =
+	"417369825632158947958724316825437169791586432346912758289643571573291684164875293";
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * @file BoardKernelsTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the BoardKernels class.
+ */
+
+#ifndef BOARD_KERNELS_TEST_H
+#define BOARD_KERNELS_TEST_H
+
+//Protected includes
+#include <cstring>
+#include <cstdlib>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/BoardKernels.h"
+#include "../lib/Candidates.h"
+
+class BoardKernelsTest : public CxxTest::TestSuite {
+
+private:
+
+	//Fills a board from a string of 81 characters ('.' for a missing value)
+	static void parse(const char* text, unsigned char* cells) {
+		for(int i = 0; i < 81; i++) {
+			cells[i] = (text[i] == '.') ? 0 : (unsigned char)(text[i] - '0');
+		}
+	}
+
+	//Checks that every supported kernel agrees with the scalar one on a board
+	static void checkKernels(const unsigned char* cells) {
+		bool valid = BoardKernels::isValid(cells, BoardKernels::SCALAR);
+		unsigned short expected[81];
+		BoardKernels::getCandidates(cells, expected, BoardKernels::SCALAR);
+		BoardKernels::InstructionSet sets[] = { BoardKernels::SSSE3, BoardKernels::AVX2 };
+		for(int s = 0; s < 2; s++) {
+			if(!BoardKernels::isSupported(sets[s])) {
+				continue;
+			}
+			TS_ASSERT_EQUALS(BoardKernels::isValid(cells, sets[s]), valid);
+			unsigned short actual[81];
+			BoardKernels::getCandidates(cells, actual, sets[s]);
+			TS_ASSERT(memcmp(actual, expected, sizeof(actual)) == 0);
+		}
+	}
+
+public:
+
+	void testIsValid() {
+		unsigned char cells[81];
+		parse("4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......", cells);
+		TS_ASSERT(BoardKernels::isValid(cells));
+		checkKernels(cells);
+
+		//A repeated digit in a row, a column, and a square in turn
+		unsigned char conflicting[81];
+		int pairs[3][2] = { { 1, 8 }, { 10, 73 }, { 10, 20 } };
+		for(int p = 0; p < 3; p++) {
+			memcpy(conflicting, cells, sizeof(cells));
+			conflicting[pairs[p][0]] = 9;
+			conflicting[pairs[p][1]] = 9;
+			TS_ASSERT(!BoardKernels::isValid(conflicting));
+			checkKernels(conflicting);
+		}
+
+		//Bytes above 9 are never valid
+		memcpy(conflicting, cells, sizeof(cells));
+		conflicting[40] = 12;
+		TS_ASSERT(!BoardKernels::isValid(conflicting));
+		checkKernels(conflicting);
+	}
+
+	void testGetCandidates() {
+		unsigned char cells[81];
+		parse(".23456789"
+			  "4.6789123"
+			  "78.123456"
+			  "234.67891"
+			  "5678.1234"
+			  "89123.567"
+			  "345678.12"
+			  "6789123.5"
+			  "91234567.", cells);
+		unsigned short candidates[81];
+		BoardKernels::getCandidates(cells, candidates);
+		TS_ASSERT_EQUALS(candidates[0], Candidates::digitToMask(1));
+		TS_ASSERT_EQUALS(candidates[10], Candidates::digitToMask(5));
+		TS_ASSERT_EQUALS(candidates[1], 0);
+		checkKernels(cells);
+	}
+
+	void testRandomBoards() {
+		srand(7);
+		unsigned char cells[81];
+		for(int trial = 0; trial < 2000; trial++) {
+			//Sparse boards are usually valid, dense ones usually are not
+			int density = trial % 40;
+			for(int i = 0; i < 81; i++) {
+				cells[i] = (rand() % 81 < density) ? (unsigned char)(1 + rand() % 9) : 0;
+			}
+			checkKernels(cells);
+		}
+	}
+
+};
+
+#endif
@@ -0,0 +1,82 @@
+/**
+ * @file BoardTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the Board class and its tables.
+ */
+
+#ifndef BOARD_TEST_H
+#define BOARD_TEST_H
+
+//Protected includes
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/Board.h"
+#include "../lib/Sudoku.h"
+
+using namespace std;
+
+class BoardTest : public CxxTest::TestSuite {
+
+public:
+
+	void testParse() {
+		string state = "1.3456789"
+					   "0x";
+		Board board;
+		board.parse(state.data(), state.size());
+		TS_ASSERT_EQUALS(board.get(0), 1);
+		TS_ASSERT(board.isEmpty(1));
+		TS_ASSERT_EQUALS(board.get(8), 9);
+		TS_ASSERT(board.isEmpty(9));
+		TS_ASSERT_EQUALS(board.get(10), Board::INVALID);
+		//Cells past the end of a short string are missing
+		TS_ASSERT(board.isEmpty(80));
+	}
+
+	void testVectorConversion() {
+		vector<int> state(81, -1);
+		state[0] = 5;
+		state[40] = 9;
+		Board board;
+		board.fromVector(state);
+		TS_ASSERT_EQUALS(board.get(40), 9);
+		vector<int> round_trip;
+		board.toVector(round_trip);
+		TS_ASSERT(round_trip == state);
+
+		//Copies are plain byte copies
+		Board copy;
+		memcpy(&copy, &board, sizeof(Board));
+		TS_ASSERT(copy == board);
+		copy.clear(0);
+		TS_ASSERT(copy != board);
+	}
+
+	void testTables() {
+		const BoardTables& tables = Board::TABLES;
+		TS_ASSERT_EQUALS(tables.box_of[Sudoku::getIndexByCoordinate(5, 6)],
+						 Sudoku::getSquareByCoordinate(5, 6));
+		TS_ASSERT_EQUALS(tables.units[9 + 2][3], 29);
+		TS_ASSERT(Sudoku::getIndicesOfSquare(4) == vector<int>({ 30, 31, 32, 39, 40, 41, 48, 49, 50 }));
+		//Every cell has twenty distinct peers, none of them itself
+		for(int index = 0; index < 81; index++) {
+			bool seen[81] = { false };
+			for(int p = 0; p < 20; p++) {
+				int peer = tables.peers[index][p];
+				TS_ASSERT(peer != index && !seen[peer]);
+				seen[peer] = true;
+			}
+		}
+		//The tables are available at compile time
+		static_assert(Board::TABLES.units[18 + 8][8] == 80, "last cell of the last square");
+	}
+
+};
+
+#endif
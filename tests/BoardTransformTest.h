@@ -0,0 +1,113 @@
+/**
+ * @file BoardTransformTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the BoardTransform structure and for canonicalization.
+ */
+
+#ifndef BOARD_TRANSFORM_TEST_H
+#define BOARD_TRANSFORM_TEST_H
+
+//Protected includes
+#include <string>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/BoardTransform.h"
+#include "../lib/BoardKernels.h"
+#include "../lib/Generator.h"
+
+using namespace std;
+
+class BoardTransformTest : public CxxTest::TestSuite {
+
+private:
+
+	static const char* PUZZLE;
+
+	//Builds a random transform (a shuffled band, stack, row, column, and digit order)
+	static BoardTransform getRandomTransform(Generator::Random& random) {
+		BoardTransform transform;
+		transform.transpose = random.below(2) == 1;
+		uint8_t* maps[2] = {transform.rows, transform.cols};
+		for(int m = 0; m < 2; m++) {
+			int bands[3] = {0, 1, 2};
+			random.shuffle(bands, 3);
+			for(int b = 0; b < 3; b++) {
+				int lines[3] = {0, 1, 2};
+				random.shuffle(lines, 3);
+				for(int k = 0; k < 3; k++) {
+					maps[m][(b * 3) + k] = (uint8_t)((bands[b] * 3) + lines[k]);
+				}
+			}
+		}
+		random.shuffle(&transform.digits[1], 9);
+		return transform;
+	}
+
+public:
+
+	void testApplyAndInvert() {
+		Board puzzle;
+		puzzle.parse(PUZZLE, 81);
+		Generator::Random random(3);
+		for(int n = 0; n < 20; n++) {
+			BoardTransform transform = getRandomTransform(random);
+			Board image;
+			transform.apply(puzzle, image);
+			TS_ASSERT(BoardKernels::isValid(image.data()));
+			Board restored;
+			transform.invert(image, restored);
+			TS_ASSERT(restored == puzzle);
+		}
+		//The identity leaves a board as it is
+		BoardTransform identity;
+		Board image;
+		identity.apply(puzzle, image);
+		TS_ASSERT(image == puzzle);
+	}
+
+	void testCanonicalFormIsShared() {
+		Board puzzle;
+		puzzle.parse(PUZZLE, 81);
+		Board canonical;
+		BoardTransform transform;
+		BoardTransform::canonicalize(puzzle, canonical, transform);
+		//The canonical form is the image of the puzzle under the transform returned
+		Board image;
+		transform.apply(puzzle, image);
+		TS_ASSERT(image == canonical);
+		Generator::Random random(11);
+		for(int n = 0; n < 20; n++) {
+			Board disguised;
+			getRandomTransform(random).apply(puzzle, disguised);
+			Board other;
+			BoardTransform other_transform;
+			BoardTransform::canonicalize(disguised, other, other_transform);
+			TS_ASSERT(other == canonical);
+			other_transform.apply(disguised, image);
+			TS_ASSERT(image == canonical);
+		}
+	}
+
+	void testDistinctPuzzles() {
+		//Adding a clue gives a puzzle that is no transform of the original
+		Board puzzle;
+		puzzle.parse(PUZZLE, 81);
+		Board more = puzzle;
+		more.set(80, 2);
+		Board first;
+		Board second;
+		BoardTransform transform;
+		BoardTransform::canonicalize(puzzle, first, transform);
+		BoardTransform::canonicalize(more, second, transform);
+		TS_ASSERT(first != second);
+	}
+
+};
+
+const char* BoardTransformTest::PUZZLE =
+	"4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......";
+
+#endif
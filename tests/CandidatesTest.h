@@ -0,0 +1,74 @@
+/**
+ * @file CandidatesTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the Candidates class.
+ */
+
+#ifndef CANDIDATES_TEST_H
+#define CANDIDATES_TEST_H
+
+//Protected includes
+#include <string>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/Candidates.h"
+#include "../lib/Sudoku.h"
+
+using namespace std;
+
+class CandidatesTest : public CxxTest::TestSuite {
+
+public:
+
+	void testPlaceAndRemove() {
+		Candidates c;
+		TS_ASSERT_EQUALS(c.get(0), Candidates::ALL_DIGITS);
+		c.place(0, 5);
+		//Same row, same column, and same square as index 0
+		TS_ASSERT(!c.allows(8, 5));
+		TS_ASSERT(!c.allows(72, 5));
+		TS_ASSERT(!c.allows(20, 5));
+		//Shares no unit with index 0
+		TS_ASSERT(c.allows(40, 5));
+		c.remove(0, 5);
+		TS_ASSERT(c.allows(8, 5));
+	}
+
+	void testLoad() {
+		string state = ".23456789"
+					   "4.6789123"
+					   "78.123456"
+					   "234.67891"
+					   "5678.1234"
+					   "89123.567"
+					   "345678.12"
+					   "6789123.5"
+					   "91234567.";
+		Sudoku s(state);
+		Candidates c;
+		TS_ASSERT(c.load(s.getStartingBoard()));
+		TS_ASSERT_EQUALS(c.get(0), Candidates::digitToMask(1));
+		TS_ASSERT_EQUALS(Candidates::lowestDigit(c.get(10)), 5);
+		TS_ASSERT_EQUALS(Candidates::countDigits(c.get(80)), 1);
+
+		vector<int> conflicting = s.getStartingBoard();
+		conflicting[0] = 2;
+		TS_ASSERT(!c.load(conflicting));
+	}
+
+	void testSquareOf() {
+		TS_ASSERT_EQUALS(Candidates::squareOf(0), 0);
+		TS_ASSERT_EQUALS(Candidates::squareOf(8), 2);
+		TS_ASSERT_EQUALS(Candidates::squareOf(40), 4);
+		TS_ASSERT_EQUALS(Candidates::squareOf(80), 8);
+		TS_ASSERT_EQUALS(Candidates::squareOf(Sudoku::getIndexByCoordinate(5, 6)),
+						 Sudoku::getSquareByCoordinate(5, 6));
+	}
+
+};
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * @file DancingLinksTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the DancingLinks class, including cross-checks against the
+ * backtracking engine.
+ */
+
+#ifndef DANCING_LINKS_TEST_H
+#define DANCING_LINKS_TEST_H
+
+//Protected includes
+#include <string>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/DancingLinks.h"
+#include "../lib/Sudoku.h"
+
+using namespace std;
+
+class DancingLinksTest : public CxxTest::TestSuite {
+
+public:
+
+	void testSolveMatchesBacktracking() {
+		string state = "........."
+					   ".....3.85"
+					   "..1.2...."
+					   "...5.7..."
+					   "..4...1.."
+					   ".9......."
+					   "5......73"
+					   "..2.1...."
+					   "....4...9";
+		Sudoku dlx(state, Sudoku::DANCING_LINKS);
+		TS_ASSERT_EQUALS(dlx.getStrategy(), Sudoku::DANCING_LINKS);
+		TS_ASSERT(dlx.solve());
+		TS_ASSERT(dlx.isComplete());
+
+		Sudoku backtracking(state);
+		TS_ASSERT(backtracking.solve());
+		//This board has exactly one solution, so both engines must agree
+		TS_ASSERT(dlx.getCurrentBoard() == backtracking.getCurrentBoard());
+	}
+
+	void testSolveKeepsGivens() {
+		string state = "87.39...."
+					   ".....85.9"
+					   "....5.1.."
+					   ".2.1..3.4"
+					   "4.3...2.5"
+					   "6.8..4.9."
+					   "..2.4...."
+					   "7........"
+					   "5...17.4.";
+		Sudoku s(state);
+		s.setStrategy(Sudoku::DANCING_LINKS);
+		TS_ASSERT(s.solve());
+		TS_ASSERT(s.isComplete());
+		vector<int> start = s.getStartingBoard();
+		vector<int> solution = s.getCurrentBoard();
+		for(int i = 0; i < 81; i++) {
+			if(start[i] != -1) {
+				TS_ASSERT_EQUALS(solution[i], start[i]);
+			}
+		}
+	}
+
+	void testUnsolvable() {
+		string state = "1.657..9."
+					   "84..2.1.."
+					   ".5.9.4..."
+					   "6.....2.3"
+					   ".82.9.74."
+					   "4.7.....1"
+					   "...4.2.1."
+					   "..5.8..39"
+					   ".7..598.4";
+		Sudoku s(state, Sudoku::DANCING_LINKS);
+		TS_ASSERT(!s.solve());
+
+		//Conflicting givens are rejected before any search
+		DancingLinks dlx;
+		vector<int> conflicting(81, -1);
+		conflicting[0] = 3;
+		conflicting[1] = 3;
+		TS_ASSERT(!dlx.load(conflicting));
+	}
+
+	void testReuseAcrossLoads() {
+		DancingLinks dlx;
+		vector<int> empty(81, -1);
+		TS_ASSERT(dlx.load(empty));
+		TS_ASSERT(dlx.solve());
+		vector<int> first;
+		dlx.getBoard(first);
+		TS_ASSERT(dlx.load(empty));
+		TS_ASSERT(dlx.solve());
+		vector<int> second;
+		dlx.getBoard(second);
+		TS_ASSERT(first == second);
+	}
+
+};
+
+#endif
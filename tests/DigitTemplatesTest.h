@@ -0,0 +1,175 @@
+/**
+ * @file DigitTemplatesTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the DigitTemplates class, including cross-checks against the
+ * dancing links engine.
+ */
+
+#ifndef DIGIT_TEMPLATES_TEST_H
+#define DIGIT_TEMPLATES_TEST_H
+
+//Protected includes
+#include <set>
+#include <string>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/DigitTemplates.h"
+#include "../lib/DancingLinks.h"
+#include "../lib/BoardKernels.h"
+#include "../lib/Candidates.h"
+#include "../lib/Sudoku.h"
+
+using namespace std;
+
+//Checks every solution it receives and collects them in one-line form
+class CollectingCallback : public SolutionCallback {
+
+public:
+
+	set<string> solutions;
+
+	bool onSolution(const int* board) {
+		string line;
+		for(int i = 0; i < 81; i++) {
+			line += (char)('0' + board[i]);
+		}
+		Board solution;
+		solution.parse(line.data(), line.size());
+		TS_ASSERT(BoardKernels::isValid(solution.data()));
+		this->solutions.insert(line);
+		return true;
+	}
+
+};
+
+class DigitTemplatesTest : public CxxTest::TestSuite {
+
+private:
+
+	//Has 24 solutions
+	static const string MULTIPLE;
+
+public:
+
+	void testTemplateTable() {
+		const vector<DigitTemplates::Mask>& templates = DigitTemplates::getTemplates();
+		TS_ASSERT_EQUALS(templates.size(), DigitTemplates::TEMPLATES);
+		set<pair<uint64_t, uint64_t> > distinct;
+		for(int t = 0; t < templates.size(); t++) {
+			const DigitTemplates::Mask& cells = templates[t];
+			distinct.insert(make_pair(cells.low, cells.high));
+			//One cell in every row, column, and square
+			int rows = 0;
+			int cols = 0;
+			int squares = 0;
+			int count = 0;
+			for(int i = 0; i < 81; i++) {
+				if(cells.contains(i)) {
+					rows |= 1 << Candidates::rowOf(i);
+					cols |= 1 << Candidates::colOf(i);
+					squares |= 1 << Candidates::squareOf(i);
+					count++;
+				}
+			}
+			TS_ASSERT_EQUALS(count, 9);
+			TS_ASSERT_EQUALS(rows, 0x1FF);
+			TS_ASSERT_EQUALS(cols, 0x1FF);
+			TS_ASSERT_EQUALS(squares, 0x1FF);
+		}
+		TS_ASSERT_EQUALS(distinct.size(), DigitTemplates::TEMPLATES);
+	}
+
+	void testSolveMatchesDancingLinks() {
+		const char* puzzles[] = {
+			"4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......",
+			"52...6.........7.13...........4..8..6......5...........418.........3..2...87.....",
+			"..............3.85..1.2.......5.7.....4...1...9.......5......73..2.1........4...9",
+			"..3.2.6..9..3.5..1..18.64....81.29..7.......8..67.82....26.95..8..2.3..9..5.1.3.."
+		};
+		for(int k = 0; k < 4; k++) {
+			Sudoku templates(puzzles[k], Sudoku::TEMPLATES);
+			TS_ASSERT_EQUALS(templates.getStrategy(), Sudoku::TEMPLATES);
+			TS_ASSERT(templates.solve());
+			TS_ASSERT(templates.isComplete());
+			Sudoku dlx(puzzles[k], Sudoku::DANCING_LINKS);
+			TS_ASSERT(dlx.solve());
+			//Each board has exactly one solution, so both engines must agree
+			TS_ASSERT(templates.getCurrentBoard() == dlx.getCurrentBoard());
+			TS_ASSERT(templates.hasUniqueSolution());
+		}
+	}
+
+	void testEnumeratesEverySolution() {
+		Board board;
+		board.parse(MULTIPLE.data(), MULTIPLE.size());
+		DigitTemplates templates;
+		TS_ASSERT(templates.load(board));
+		CollectingCallback found;
+		TS_ASSERT_EQUALS(templates.countSolutions(0, &found), 24);
+		TS_ASSERT_EQUALS(found.solutions.size(), 24);
+		//Removing givens opens up many more solutions; the engines must count them alike
+		string sparse = MULTIPLE;
+		sparse[0] = '.';
+		sparse[3] = '.';
+		sparse[13] = '.';
+		board.parse(sparse.data(), sparse.size());
+		TS_ASSERT(templates.load(board));
+		DancingLinks dlx;
+		TS_ASSERT(dlx.load(board));
+		long count = dlx.countSolutions(0);
+		TS_ASSERT(count > 24);
+		TS_ASSERT_EQUALS(templates.countSolutions(0), count);
+		TS_ASSERT_EQUALS(templates.countSolutions(5), 5);
+	}
+
+	void testUnsolvable() {
+		Sudoku s("1.657..9.84..2.1...5.9.4...6.....2.3.82.9.74.4.7.....1...4.2.1...5.8..39.7..598.4",
+				 Sudoku::TEMPLATES);
+		TS_ASSERT(!s.solve());
+		//Conflicting givens are rejected before any search
+		DigitTemplates templates;
+		vector<int> conflicting(81, -1);
+		conflicting[0] = 3;
+		conflicting[1] = 3;
+		TS_ASSERT(!templates.load(conflicting));
+	}
+
+	void testLimits() {
+		DigitTemplates templates;
+		vector<int> empty(81, -1);
+		TS_ASSERT(templates.load(empty));
+		SearchLimits limits;
+		limits.setMaxNodes(5000);
+		templates.setLimits(limits);
+		TS_ASSERT(templates.countSolutions(0) > 0);
+		TS_ASSERT(templates.isExhausted());
+		TS_ASSERT(templates.getStats().nodes <= 5000 + SearchLimits::CHECK_INTERVAL);
+	}
+
+	void testReuseAcrossLoads() {
+		DigitTemplates templates;
+		vector<int> empty(81, -1);
+		TS_ASSERT(templates.load(empty));
+		TS_ASSERT(templates.solve());
+		vector<int> first;
+		templates.getBoard(first);
+		TS_ASSERT(templates.load(empty));
+		TS_ASSERT(templates.solve());
+		vector<int> second;
+		templates.getBoard(second);
+		TS_ASSERT(first == second);
+		for(int i = 0; i < 81; i++) {
+			TS_ASSERT(first[i] >= 1 && first[i] <= 9);
+		}
+	}
+
+};
+
+const string DigitTemplatesTest::MULTIPLE =
+	"87.39.........85.9....5.1...2.1..3.44.3...2.56.8..4.9...2.4....7........5...17.4.";
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * @file GeneratorTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the Generator class.
+ */
+
+#ifndef GENERATOR_TEST_H
+#define GENERATOR_TEST_H
+
+//Protected includes
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/Generator.h"
+#include "../lib/BoardKernels.h"
+#include "../lib/Sudoku.h"
+
+using namespace std;
+
+class GeneratorTest : public CxxTest::TestSuite {
+
+public:
+
+	void testCompleteGrids() {
+		Generator::Random random(5);
+		Generator::Engine engine;
+		for(int n = 0; n < 20; n++) {
+			Board grid;
+			Generator::generateGrid(random, engine, grid);
+			TS_ASSERT_EQUALS(Generator::countClues(grid), 81);
+			TS_ASSERT(BoardKernels::isValid(grid.data()));
+		}
+	}
+
+	void testUniqueSolutions() {
+		Generator generator(42);
+		Board puzzle;
+		for(int i = 0; i < 10; i++) {
+			generator.generate(i, puzzle);
+			Sudoku s("");
+			string line(81, '.');
+			for(int k = 0; k < 81; k++) {
+				line[k] = puzzle.isEmpty(k) ? '.' : (char)('0' + puzzle.get(k));
+			}
+			s.setState(line);
+			TS_ASSERT(s.hasUniqueSolution());
+			//A minimal puzzle: no clue can be removed without losing uniqueness
+			for(int k = 0; k < 81; k += 7) {
+				if(!puzzle.isEmpty(k)) {
+					string fewer = line;
+					fewer[k] = '.';
+					s.setState(fewer);
+					TS_ASSERT_LESS_THAN(1, s.countSolutions(2));
+				}
+			}
+		}
+	}
+
+	void testTargetAndSymmetry() {
+		Generator generator(7);
+		generator.setClues(30);
+		generator.setSymmetry(Generator::ROTATIONAL);
+		Board puzzle;
+		for(int i = 0; i < 10; i++) {
+			generator.generate(i, puzzle);
+			TS_ASSERT_LESS_THAN_EQUALS(Generator::countClues(puzzle), 31);
+			for(int k = 0; k < 81; k++) {
+				TS_ASSERT_EQUALS(puzzle.isEmpty(k), puzzle.isEmpty(80 - k));
+			}
+		}
+		generator.setClues(-5);
+		TS_ASSERT_EQUALS(generator.getClues(), 0);
+		generator.setClues(100);
+		TS_ASSERT_EQUALS(generator.getClues(), 81);
+	}
+
+	void testReproducible() {
+		Generator sequential(99, 1);
+		sequential.setClues(28);
+		stringstream first;
+		GeneratorSummary summary = sequential.run(150, first);
+		TS_ASSERT_EQUALS(summary.puzzles, 150);
+		TS_ASSERT_EQUALS(summary.above_target, 0);
+		TS_ASSERT_EQUALS(summary.getMeanClues(), 28);
+
+		Generator parallel(99, 3);
+		parallel.setClues(28);
+		stringstream second;
+		parallel.run(150, second);
+		TS_ASSERT_EQUALS(first.str(), second.str());
+
+		//Every line is a puzzle in the one-line format, and a different seed differs
+		string line;
+		getline(first, line);
+		TS_ASSERT_EQUALS(line.size(), 81);
+		Board puzzle;
+		Generator other(100);
+		other.setClues(28);
+		other.generate(0, puzzle);
+		string other_line(81, '.');
+		for(int k = 0; k < 81; k++) {
+			other_line[k] = puzzle.isEmpty(k) ? '.' : (char)('0' + puzzle.get(k));
+		}
+		TS_ASSERT_DIFFERS(line, other_line);
+	}
+
+	void testSymmetryHelpers() {
+		TS_ASSERT_EQUALS(Generator::getImage(0, Generator::NONE), 0);
+		TS_ASSERT_EQUALS(Generator::getImage(0, Generator::ROTATIONAL), 80);
+		TS_ASSERT_EQUALS(Generator::getImage(40, Generator::ROTATIONAL), 40);
+		TS_ASSERT_EQUALS(Generator::getImage(10, Generator::MIRROR), 16);
+		TS_ASSERT_EQUALS(Generator::getImage(1, Generator::DIAGONAL), 9);
+		Generator::Symmetry symmetry;
+		TS_ASSERT(Generator::parseSymmetry("mirror", symmetry));
+		TS_ASSERT_EQUALS(symmetry, Generator::MIRROR);
+		TS_ASSERT(!Generator::parseSymmetry("spiral", symmetry));
+	}
+
+	void testIsForced() {
+		Board board;
+		const char* row = "12345678.";
+		board.parse(row, 9);
+		TS_ASSERT(Generator::isForced(board, 8));
+		TS_ASSERT(!Generator::isForced(board, 9));
+	}
+
+};
+
+#endif
@@ -0,0 +1,189 @@
+/**
+ * @file GridPuzzleTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the GridPuzzle class, and for the GridBacktracker template on
+ * grids other than 9x9.
+ */
+
+#ifndef GRID_PUZZLE_TEST_H
+#define GRID_PUZZLE_TEST_H
+
+//Protected includes
+#include <string>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/Backtracker.h"
+#include "../lib/GridPuzzle.h"
+#include "../lib/Sudoku.h"
+
+using namespace std;
+
+class GridPuzzleTest : public CxxTest::TestSuite {
+
+private:
+
+	/**
+	 * Builds a puzzle with boxes of 'box' cells per side from a patterned solution,
+	 * leaving roughly half of its cells blank, in the token format.
+	 */
+	static string makeGrid(int box, vector<int>& givens) {
+		int side = box * box;
+		givens.assign(side * side, -1);
+		string text;
+		for(int row = 0; row < side; row++) {
+			for(int col = 0; col < side; col++) {
+				int index = (row * side) + col;
+				int value = ((((row % box) * box) + (row / box) + col) % side) + 1;
+				if((index * 7) % 11 < 6) {
+					givens[index] = value;
+					text += to_string(value);
+				} else {
+					text += ".";
+				}
+				text += (col == side - 1) ? "\n" : " ";
+			}
+		}
+		return text;
+	}
+
+	//Checks that a grid is complete, valid, and keeps every given
+	static void checkSolution(int box, const vector<int>& givens, const vector<int>& solution) {
+		int side = box * box;
+		TS_ASSERT_EQUALS((int)solution.size(), side * side);
+		for(int unit = 0; unit < 3 * side; unit++) {
+			vector<bool> seen(side + 1, false);
+			for(int k = 0; k < side; k++) {
+				int index = (unit < side) ? (unit * side) + k :
+							(unit < 2 * side) ? (k * side) + (unit - side) :
+							((((unit - (2 * side)) / box) * box + (k / box)) * side) +
+							(((unit - (2 * side)) % box) * box) + (k % box);
+				int value = solution[index];
+				TS_ASSERT(value >= 1 && value <= side && !seen[value]);
+				if(value >= 1 && value <= side) {
+					seen[value] = true;
+				}
+			}
+		}
+		for(int i = 0; i < givens.size(); i++) {
+			if(givens[i] != -1) {
+				TS_ASSERT_EQUALS(solution[i], givens[i]);
+			}
+		}
+	}
+
+public:
+
+	void testEverySize() {
+		for(int box = 2; box <= 5; box++) {
+			vector<int> givens;
+			GridPuzzle grid(box);
+			TS_ASSERT(grid.setState(makeGrid(box, givens)));
+			TS_ASSERT(grid.getStartingBoard() == givens);
+			TS_ASSERT(grid.solve());
+			checkSolution(box, givens, grid.getCurrentBoard());
+		}
+	}
+
+	void testMatchesSudoku() {
+		string state = "4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......";
+		Sudoku s(state);
+		s.setCellOrder(Backtracker::MINIMUM_REMAINING_VALUES);
+		TS_ASSERT(s.solve());
+		GridBacktracker<3> engine;
+		engine.setCellOrder(GridBacktracker<3>::MINIMUM_REMAINING_VALUES);
+		TS_ASSERT(engine.load(Sudoku(state).getStartingBoard()));
+		TS_ASSERT(engine.solve());
+		vector<int> board;
+		engine.getBoard(board);
+		TS_ASSERT(board == s.getCurrentBoard());
+
+		//The same puzzle, read by GridPuzzle in the character format
+		GridPuzzle grid(3);
+		TS_ASSERT(grid.setState(state));
+		TS_ASSERT_EQUALS(grid.countSolutions(0), 1);
+	}
+
+	void testCountSolutions() {
+		//Twenty-four solutions (see input/state8-24sol.txt)
+		string state = "87.39...."
+					   ".....85.9"
+					   "....5.1.."
+					   ".2.1..3.4"
+					   "4.3...2.5"
+					   "6.8..4.9."
+					   "..2.4...."
+					   "7........"
+					   "5...17.4.";
+		GridPuzzle grid(3);
+		TS_ASSERT(grid.setState(state));
+		TS_ASSERT_EQUALS(grid.countSolutions(0), 24);
+		TS_ASSERT_EQUALS(grid.countSolutions(2), 2);
+		TS_ASSERT(grid.getCurrentBoard() == grid.getStartingBoard());
+	}
+
+	void testParse() {
+		vector<int> cells;
+		//Tokens: multi-digit cells, blanks written three ways
+		string tokens = "1 . 3 4, 3 4 - 2 | 2 0 4 3 4 3 2 1";
+		TS_ASSERT(GridPuzzle::parse(tokens, 4, cells));
+		TS_ASSERT_EQUALS(cells[1], -1);
+		TS_ASSERT_EQUALS(cells[6], -1);
+		TS_ASSERT_EQUALS(cells[9], -1);
+		TS_ASSERT_EQUALS(cells[15], 1);
+		//Characters, with letters for digits above 9
+		string characters(256, '.');
+		characters[0] = 'G';
+		characters[1] = 'a';
+		TS_ASSERT(GridPuzzle::parse(characters, 16, cells));
+		TS_ASSERT_EQUALS(cells[0], 16);
+		TS_ASSERT_EQUALS(cells[1], 10);
+		//Out of range, or the wrong number of cells
+		TS_ASSERT(!GridPuzzle::parse("1 2 3 5 . . . . . . . . . . . .", 4, cells));
+		TS_ASSERT(!GridPuzzle::parse(string(255, '.'), 16, cells));
+		characters[0] = 'H';
+		TS_ASSERT(!GridPuzzle::parse(characters, 16, cells));
+
+		string line;
+		GridPuzzle::formatLine(vector<int>({ 12, -1, 3 }), line);
+		TS_ASSERT_EQUALS(line, "12 . 3");
+	}
+
+	void testConflictingGivens() {
+		GridBacktracker<4> engine;
+		vector<int> state(256, -1);
+		state[0] = 16;
+		state[15] = 16;
+		TS_ASSERT(!engine.load(state));
+		state[15] = 17;
+		TS_ASSERT(!engine.load(state));
+	}
+
+	void testBacktrackerOnOtherSizes() {
+		//There are 288 complete 4x4 grids; every heuristic must find all of them
+		vector<int> empty(16, -1);
+		GridBacktracker<2> plain;
+		TS_ASSERT(plain.load(empty));
+		TS_ASSERT_EQUALS(plain.countSolutions(0), 288);
+		GridBacktracker<2> heuristic;
+		heuristic.setCellOrder(GridBacktracker<2>::MINIMUM_REMAINING_VALUES);
+		heuristic.setValueOrder(GridBacktracker<2>::LEAST_CONSTRAINING);
+		heuristic.setPropagation(true);
+		TS_ASSERT(heuristic.load(empty));
+		TS_ASSERT_EQUALS(heuristic.countSolutions(0), 288);
+		//Search limits apply to every size
+		GridBacktracker<4> sixteen;
+		TS_ASSERT(sixteen.load(vector<int>(256, -1)));
+		SearchLimits limits;
+		limits.setMaxNodes(10);
+		sixteen.setLimits(limits);
+		sixteen.countSolutions(0);
+		TS_ASSERT(sixteen.isExhausted());
+	}
+
+};
+
+#endif
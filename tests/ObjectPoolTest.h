@@ -0,0 +1,93 @@
+/**
+ * @file ObjectPoolTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the ObjectPool template.
+ */
+
+#ifndef OBJECT_POOL_TEST_H
+#define OBJECT_POOL_TEST_H
+
+//Protected includes
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+//Header include
+#include "../lib/ObjectPool.h"
+
+using namespace std;
+
+class ObjectPoolTest : public CxxTest::TestSuite {
+
+public:
+
+	void testReusesReleasedObjects() {
+		ObjectPool<string> pool;
+		string* first = pool.acquire();
+		string* second = pool.acquire();
+		TS_ASSERT(first != second);
+		TS_ASSERT_EQUALS(pool.getCreated(), 2);
+		//A released object comes back as it was left, capacity and all
+		first->assign(100, 'x');
+		pool.release(first);
+		string* third = pool.acquire();
+		TS_ASSERT_EQUALS(third, first);
+		TS_ASSERT_EQUALS(third->size(), 100);
+		TS_ASSERT_EQUALS(pool.getCreated(), 2);
+		pool.release(second);
+		pool.release(third);
+	}
+
+	void testAcrossThreads() {
+		ObjectPool<vector<int> > pool;
+		vector<thread> threads;
+		for(int t = 0; t < 4; t++) {
+			threads.push_back(thread([&pool]() {
+				for(int i = 0; i < 1000; i++) {
+					vector<int>* values = pool.acquire();
+					values->push_back(i);
+					pool.release(values);
+				}
+			}));
+		}
+		for(int t = 0; t < 4; t++) {
+			threads[t].join();
+		}
+		//Never more objects than were in use at once
+		TS_ASSERT(pool.getCreated() >= 1);
+		TS_ASSERT(pool.getCreated() <= 4);
+	}
+
+	void testWorkerShelves() {
+		ObjectPool<string> pool(2);
+		const size_t COUNT = 2 * ObjectPool<string>::SHELF_LIMIT;
+		vector<string*> objects;
+		for(size_t i = 0; i < COUNT; i++) {
+			objects.push_back(pool.acquire());
+		}
+		//Enough to overflow worker 0's shelf onto the shared list, and to half fill worker 1's
+		for(size_t i = 0; i < COUNT; i++) {
+			pool.release(objects[i], (i < ObjectPool<string>::SHELF_LIMIT + 1) ? 0 : 1);
+		}
+		//Every released object is found again, whichever list it ended up on
+		for(size_t i = 0; i < COUNT; i++) {
+			objects[i] = pool.acquire();
+		}
+		TS_ASSERT_EQUALS(pool.getCreated(), COUNT);
+		sort(objects.begin(), objects.end());
+		TS_ASSERT(adjacent_find(objects.begin(), objects.end()) == objects.end());
+		//A worker outside the pool's range releases onto the shared list
+		for(size_t i = 0; i < COUNT; i++) {
+			pool.release(objects[i], (i % 2 == 0) ? 5 : -1);
+		}
+		pool.acquire();
+		TS_ASSERT_EQUALS(pool.getCreated(), COUNT);
+	}
+
+};
+
+#endif
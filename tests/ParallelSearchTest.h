@@ -0,0 +1,113 @@
+/**
+ * @file ParallelSearchTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the ParallelSearch class.
+ */
+
+#ifndef PARALLEL_SEARCH_TEST_H
+#define PARALLEL_SEARCH_TEST_H
+
+//Protected includes
+#include <string>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/ParallelSearch.h"
+#include "../lib/Sudoku.h"
+
+using namespace std;
+
+class ParallelSearchTest : public CxxTest::TestSuite {
+
+public:
+
+	void testCountSolutions() {
+		string state = "87.39...."
+					   ".....85.9"
+					   "....5.1.."
+					   ".2.1..3.4"
+					   "4.3...2.5"
+					   "6.8..4.9."
+					   "..2.4...."
+					   "7........"
+					   "5...17.4.";
+		ThreadPool pool(4);
+		Backtracker configuration;
+		configuration.setCellOrder(Backtracker::MINIMUM_REMAINING_VALUES);
+		ParallelSearch search(pool, configuration);
+		Board board = Sudoku(state).getStartingCells();
+		TS_ASSERT_EQUALS(search.countSolutions(board, 0), 24);
+		TS_ASSERT_EQUALS(search.countSolutions(board, 2), 2);
+		TS_ASSERT_LESS_THAN(0, search.getStats().nodes);
+
+		//Splitting at the root only, or not at all, must not change the answer
+		search.setSplitDepth(1);
+		TS_ASSERT_EQUALS(search.countSolutions(board, 0), 24);
+		search.setSplitDepth(0);
+		TS_ASSERT_EQUALS(search.countSolutions(board, 0), 24);
+	}
+
+	void testSolve() {
+		string state = "4.....8.5"
+					   ".3......."
+					   "...7....."
+					   ".2.....6."
+					   "....8.4.."
+					   "....1...."
+					   "...6.3.7."
+					   "5..2....."
+					   "1.4......";
+		Sudoku sequential(state);
+		sequential.setCellOrder(Backtracker::MINIMUM_REMAINING_VALUES);
+		TS_ASSERT(sequential.solve());
+
+		Sudoku parallel(state);
+		parallel.setCellOrder(Backtracker::MINIMUM_REMAINING_VALUES);
+		parallel.setThreads(4);
+		TS_ASSERT_EQUALS(parallel.getThreads(), 4);
+		TS_ASSERT(parallel.solve());
+		TS_ASSERT(parallel.getCurrentBoard() == sequential.getCurrentBoard());
+		TS_ASSERT(parallel.hasUniqueSolution());
+
+		string unsolvable = "1.657..9."
+							"84..2.1.."
+							".5.9.4..."
+							"6.....2.3"
+							".82.9.74."
+							"4.7.....1"
+							"...4.2.1."
+							"..5.8..39"
+							".7..598.4";
+		Sudoku s(unsolvable);
+		s.setThreads(3);
+		TS_ASSERT(!s.solve());
+		TS_ASSERT_EQUALS(s.countSolutions(), 0);
+	}
+
+	void testPoolReusedAcrossSolves() {
+		string state = "4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......";
+		Sudoku sequential(state);
+		TS_ASSERT(sequential.solve());
+		//One object's worker threads serve every search it runs, before and after a copy
+		//(which starts its own) and a change in the number of threads
+		Sudoku parallel(state);
+		parallel.setThreads(2);
+		for(int k = 0; k < 3; k++) {
+			parallel.setState(state);
+			TS_ASSERT(parallel.solve());
+			TS_ASSERT(parallel.getCurrentBoard() == sequential.getCurrentBoard());
+		}
+		Sudoku copy = parallel;
+		copy.setState(state);
+		TS_ASSERT(copy.solve());
+		TS_ASSERT(copy.getCurrentBoard() == sequential.getCurrentBoard());
+		parallel.setThreads(3);
+		TS_ASSERT_EQUALS(parallel.countSolutions(), 1);
+	}
+
+};
+
+#endif
@@ -0,0 +1,124 @@
+/**
+ * @file PuzzleReaderTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the StreamPuzzleReader and MappedPuzzleReader classes.
+ */
+
+#ifndef PUZZLE_READER_TEST_H
+#define PUZZLE_READER_TEST_H
+
+//Protected includes
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/PuzzleReader.h"
+#include "../lib/BatchSolver.h"
+#include "../lib/Sudoku.h"
+
+using namespace std;
+
+class PuzzleReaderTest : public CxxTest::TestSuite {
+
+private:
+
+	//A corpus with comments, blank lines, a DOS line ending, and no final newline
+	static const char* getCorpus() {
+		return "# A comment, followed by a blank line\n"
+			   "\n"
+			   "1.657..9.84..2.1...5.9.4...6.....2.3.82.9.74.4.7.....1...4.2.1...5.8..39.7..598.4\r\n"
+			   "  \t\n"
+			   "12345\n"
+			   "..3.2.6..9..3.5..1..18.64....81.29..7.......8..67.82....26.95..8..2.3..9..5.1.3..";
+	}
+
+	//A file of its own for each test, so that concurrent runs never share one
+	string path;
+
+	string writeCorpus(const string& contents) {
+		ofstream file(this->path.c_str(), ios::binary | ios::trunc);
+		file << contents;
+		return this->path;
+	}
+
+public:
+
+	void setUp() {
+		char name[] = "/tmp/PuzzleReaderTest.XXXXXX";
+		int descriptor = mkstemp(name);
+		TS_ASSERT(descriptor >= 0);
+		close(descriptor);
+		this->path = name;
+	}
+
+	void tearDown() {
+		unlink(this->path.c_str());
+	}
+
+	void testMappedReader() {
+		string path = writeCorpus(getCorpus());
+		MappedPuzzleReader reader;
+		TS_ASSERT(reader.open(path));
+		TS_ASSERT(reader.isOpen());
+		PuzzleView view;
+		string storage;
+		const char* expected[3] = {
+			"1.657..9.84..2.1...5.9.4...6.....2.3.82.9.74.4.7.....1...4.2.1...5.8..39.7..598.4",
+			"12345",
+			"..3.2.6..9..3.5..1..18.64....81.29..7.......8..67.82....26.95..8..2.3..9..5.1.3.."
+		};
+		for(int i = 0; i < 3; i++) {
+			TS_ASSERT(reader.next(view, storage));
+			TS_ASSERT_EQUALS(string(view.data, view.size), expected[i]);
+		}
+		TS_ASSERT(!reader.next(view, storage));
+		//Views point into the mapping itself
+		TS_ASSERT(storage.empty());
+		reader.close();
+		TS_ASSERT(!reader.isOpen());
+	}
+
+	void testOpenFailures() {
+		MappedPuzzleReader reader;
+		TS_ASSERT(!reader.open("/nonexistent/corpus.txt"));
+		TS_ASSERT(!reader.open("/tmp"));
+		//An empty corpus opens, but has no puzzles
+		string path = writeCorpus("");
+		TS_ASSERT(reader.open(path));
+		PuzzleView view;
+		string storage;
+		TS_ASSERT(!reader.next(view, storage));
+	}
+
+	void testBatchMatchesStream() {
+		string path = writeCorpus(getCorpus());
+		BatchSolver batch(Sudoku("", Sudoku::DANCING_LINKS));
+		stringstream input(getCorpus());
+		stringstream streamed;
+		BatchSummary summary = batch.run(input, streamed);
+		MappedPuzzleReader reader;
+		TS_ASSERT(reader.open(path));
+		stringstream mapped;
+		BatchSummary mapped_summary = batch.run(reader, mapped);
+		TS_ASSERT_EQUALS(mapped.str(), streamed.str());
+		TS_ASSERT_EQUALS(mapped_summary.puzzles, 3);
+		TS_ASSERT_EQUALS(mapped_summary.solved, summary.solved);
+		TS_ASSERT_EQUALS(mapped_summary.invalid, 1);
+		//Again across threads
+		TS_ASSERT(reader.open(path));
+		stringstream parallel;
+		batch.setThreads(3);
+		batch.run(reader, parallel);
+		TS_ASSERT_EQUALS(parallel.str(), streamed.str());
+	}
+
+};
+
+#endif
@@ -0,0 +1,171 @@
+/**
+ * @file SolutionCacheTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the SolutionCache class, and for its use by the Sudoku class.
+ */
+
+#ifndef SOLUTION_CACHE_TEST_H
+#define SOLUTION_CACHE_TEST_H
+
+//Protected includes
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include <fstream>
+#include <string>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/SolutionCache.h"
+#include "../lib/BoardTransform.h"
+#include "../lib/Sudoku.h"
+
+using namespace std;
+
+class SolutionCacheTest : public CxxTest::TestSuite {
+
+private:
+
+	static Board getBoard(char digit) {
+		Board board;
+		board.set(0, (uint8_t)(digit - '0'));
+		return board;
+	}
+
+	//A file of its own for each test, so that concurrent runs never share one
+	string path;
+
+public:
+
+	void setUp() {
+		char name[] = "/tmp/SolutionCacheTest.XXXXXX";
+		int descriptor = mkstemp(name);
+		TS_ASSERT(descriptor >= 0);
+		close(descriptor);
+		this->path = name;
+	}
+
+	void tearDown() {
+		unlink(this->path.c_str());
+	}
+
+	void testLeastRecentlyUsed() {
+		SolutionCache cache(2);
+		Board solution;
+		bool solvable = false;
+		cache.insert(getBoard('1'), getBoard('4'), true);
+		cache.insert(getBoard('2'), solution, false);
+		TS_ASSERT(cache.find(getBoard('1'), solution, solvable));
+		TS_ASSERT(solvable);
+		TS_ASSERT(solution == getBoard('4'));
+		//The second entry is now the least recently used, and is dropped
+		cache.insert(getBoard('3'), getBoard('5'), true);
+		TS_ASSERT_EQUALS(cache.size(), 2);
+		TS_ASSERT(!cache.find(getBoard('2'), solution, solvable));
+		TS_ASSERT(cache.find(getBoard('3'), solution, solvable));
+		TS_ASSERT_EQUALS(cache.getHits(), 2);
+		TS_ASSERT_EQUALS(cache.getMisses(), 1);
+		cache.clear();
+		TS_ASSERT_EQUALS(cache.size(), 0);
+		TS_ASSERT_EQUALS(cache.getHits(), 0);
+	}
+
+	void testSaveAndLoad() {
+		const string grid = "123456789456789123789123456234567891567891234891234567345678912678912345912345678";
+		//The grid with its first two rows cleared, and a puzzle with conflicting givens
+		Board puzzle;
+		puzzle.parse((string(18, '.') + grid.substr(18)).data(), 81);
+		Board solved;
+		solved.parse(grid.data(), 81);
+		Board conflict = puzzle;
+		conflict.set(0, 2);
+		SolutionCache cache(10);
+		cache.insert(puzzle, solved, true);
+		cache.insert(conflict, Board(), false);
+		TS_ASSERT(cache.save(this->path));
+		//Entries which don't hold up are skipped: an incomplete solution, one that breaks
+		//a rule, one that disagrees with a given, and a puzzle with too few clues
+		string incomplete = "." + grid.substr(1);
+		string bad_rule = grid;
+		swap(bad_rule[0], bad_rule[9]);
+		//Every 1 and 2 exchanged: still a valid grid, but not this puzzle's
+		string bad_given = grid;
+		for(int i = 0; i < 81; i++) {
+			bad_given[i] = (grid[i] == '1') ? '2' : (grid[i] == '2') ? '1' : grid[i];
+		}
+		string key;
+		SolutionCache::getKey(puzzle, key);
+		ofstream output(this->path.c_str(), ios::app);
+		output << key << " " << incomplete << "\n" << key << " " << bad_rule << "\n"
+			   << key << " " << bad_given << "\n" << string(80, '.') << "1 unsolvable\n";
+		output.close();
+		SolutionCache loaded(10);
+		TS_ASSERT_EQUALS(loaded.load(this->path), 2);
+		TS_ASSERT_EQUALS(loaded.size(), 2);
+		Board solution;
+		bool solvable = true;
+		TS_ASSERT(loaded.find(conflict, solution, solvable));
+		TS_ASSERT(!solvable);
+		TS_ASSERT(loaded.find(puzzle, solution, solvable));
+		TS_ASSERT(solvable);
+		TS_ASSERT(solution == solved);
+		remove(this->path.c_str());
+		TS_ASSERT_EQUALS(loaded.load(this->path), -1);
+	}
+
+	void testIsCacheable() {
+		Board board;
+		TS_ASSERT(!SolutionCache::isCacheable(board));
+		for(int i = 0; i < SolutionCache::MINIMUM_CLUES; i++) {
+			board.set(i * 4, (uint8_t)((i % 9) + 1));
+		}
+		TS_ASSERT(SolutionCache::isCacheable(board));
+		board.set(1, Board::INVALID);
+		TS_ASSERT(!SolutionCache::isCacheable(board));
+	}
+
+	void testSolveThroughCache() {
+		const string puzzle = "4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......";
+		//The same puzzle with its digits relabeled (each digit d written as 10 - d) and transposed
+		string disguised(81, '.');
+		for(int i = 0; i < 81; i++) {
+			char c = puzzle[((i % 9) * 9) + (i / 9)];
+			disguised[i] = (c == '.') ? '.' : (char)('0' + (10 - (c - '0')));
+		}
+		SolutionCache cache(16);
+		Sudoku s(puzzle);
+		s.setCache(&cache);
+		TS_ASSERT(s.solve());
+		TS_ASSERT(s.isComplete());
+		TS_ASSERT_EQUALS(cache.getMisses(), 1);
+
+		Sudoku copy(s);
+		copy.setState(disguised);
+		TS_ASSERT(copy.solve());
+		TS_ASSERT_EQUALS(cache.getHits(), 1);
+		TS_ASSERT(copy.isComplete());
+		TS_ASSERT_EQUALS(copy.getStats().nodes, 0);
+		//The answer agrees with the disguised puzzle's givens
+		const Board& solved = copy.getCurrentCells();
+		for(int i = 0; i < 81; i++) {
+			if(disguised[i] != '.') {
+				TS_ASSERT_EQUALS(solved.get(i), disguised[i] - '0');
+			}
+		}
+
+		//Unsolvable puzzles are remembered as such (triage would turn this one away first)
+		string conflict = puzzle;
+		conflict[1] = '4';
+		s.setTriage(false);
+		s.setState(conflict);
+		TS_ASSERT(!s.solve());
+		s.setState(conflict);
+		TS_ASSERT(!s.solve());
+		TS_ASSERT_EQUALS(cache.getHits(), 2);
+	}
+
+};
+
+#endif
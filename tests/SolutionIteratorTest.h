@@ -0,0 +1,176 @@
+/**
+ * @file SolutionIteratorTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the SolutionIterator template.
+ */
+
+#ifndef SOLUTION_ITERATOR_TEST_H
+#define SOLUTION_ITERATOR_TEST_H
+
+//Protected includes
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/SolutionIterator.h"
+#include "../lib/Backtracker.h"
+#include "../lib/GridPuzzle.h"
+#include "../lib/Sudoku.h"
+
+using namespace std;
+
+class SolutionIteratorTest : public CxxTest::TestSuite {
+
+private:
+
+	//Has 24 solutions
+	static const string MULTIPLE;
+
+	//Collects the solutions a recursive search hands over, in the iterator's line form
+	class Recorder : public SolutionCallback {
+	public:
+		set<string> lines;
+		bool onSolution(const int* board) {
+			string line;
+			GridPuzzle::formatLine(vector<int>(board, board + 81), line);
+			this->lines.insert(line);
+			return true;
+		}
+	};
+
+	//Drains an iterator, collecting every solution it has left in one-line form
+	template<int BOX>
+	static vector<string> drain(SolutionIterator<BOX>& solutions, const SearchLimits& limits = SearchLimits()) {
+		vector<string> found;
+		typename SolutionIterator<BOX>::Status status;
+		while((status = solutions.next(limits)) != SolutionIterator<BOX>::FINISHED) {
+			if(status == SolutionIterator<BOX>::FOUND) {
+				vector<int> cells;
+				solutions.getSolution(cells);
+				string line;
+				GridPuzzle::formatLine(cells, line);
+				found.push_back(line);
+			}
+		}
+		return found;
+	}
+
+public:
+
+	void testEnumeratesEverySolution() {
+		Sudoku sudoku(MULTIPLE);
+		SolutionIterator<3> solutions = sudoku.getSolutionIterator();
+		vector<string> found = drain(solutions);
+		TS_ASSERT_EQUALS(found.size(), 24);
+		TS_ASSERT_EQUALS(set<string>(found.begin(), found.end()).size(), 24);
+		for(int i = 0; i < found.size(); i++) {
+			string line = found[i];
+			line.erase(remove(line.begin(), line.end(), ' '), line.end());
+			Sudoku check(line);
+			TS_ASSERT(check.isComplete());
+		}
+		TS_ASSERT(solutions.isFinished());
+		TS_ASSERT_EQUALS(solutions.getSolutions(), 24);
+		TS_ASSERT_EQUALS(solutions.getDepth(), 0);
+		TS_ASSERT_EQUALS(solutions.next(), SolutionIterator<3>::FINISHED);
+	}
+
+	void testMatchesRecursiveSearch() {
+		Sudoku sudoku(MULTIPLE);
+		SolutionIterator<3> solutions = sudoku.getSolutionIterator();
+		vector<string> found = drain(solutions);
+		Backtracker solver;
+		solver.setCellOrder(Backtracker::MINIMUM_REMAINING_VALUES);
+		TS_ASSERT(solver.load(sudoku.getStartingCells()));
+		Recorder recorder;
+		TS_ASSERT_EQUALS(solver.countSolutions(0, &recorder), 24);
+		TS_ASSERT(set<string>(found.begin(), found.end()) == recorder.lines);
+	}
+
+	void testSnapshotAndResume() {
+		Sudoku sudoku(MULTIPLE);
+		SolutionIterator<3> solutions = sudoku.getSolutionIterator();
+		vector<string> all = drain(solutions);
+		solutions = sudoku.getSolutionIterator();
+		solutions.next();
+		solutions.next();
+		//A copy carries on from the same point, independently of the original
+		SolutionIterator<3> snapshot = solutions;
+		vector<string> rest = drain(solutions);
+		TS_ASSERT(rest == vector<string>(all.begin() + 2, all.end()));
+		TS_ASSERT(drain(snapshot) == rest);
+	}
+
+	void testTimeSlicing() {
+		Sudoku sudoku(MULTIPLE);
+		SolutionIterator<3> solutions = sudoku.getSolutionIterator();
+		vector<string> all = drain(solutions);
+		long nodes = solutions.getStats().nodes;
+		//Suspended every few nodes, the search still yields the same solutions in order
+		solutions = sudoku.getSolutionIterator();
+		SearchLimits slice;
+		slice.setMaxNodes(3);
+		long suspensions = 0;
+		vector<string> sliced;
+		SolutionIterator<3>::Status status;
+		while((status = solutions.next(slice)) != SolutionIterator<3>::FINISHED) {
+			if(status == SolutionIterator<3>::SUSPENDED) {
+				suspensions++;
+			} else {
+				vector<int> cells;
+				solutions.getSolution(cells);
+				string line;
+				GridPuzzle::formatLine(cells, line);
+				sliced.push_back(line);
+			}
+		}
+		TS_ASSERT(sliced == all);
+		TS_ASSERT_EQUALS(solutions.getStats().nodes, nodes);
+		//Every call runs at most three nodes
+		TS_ASSERT((suspensions + 24 + 1) * 3 >= nodes);
+		TS_ASSERT(suspensions > 0);
+	}
+
+	void testLargeGrids() {
+		//Empty grids are the deepest searches there are: one frame per cell
+		SolutionIterator<4> sixteen;
+		TS_ASSERT_EQUALS(sixteen.next(), SolutionIterator<4>::FOUND);
+		TS_ASSERT_EQUALS(sixteen.getDepth(), 256);
+		SolutionIterator<5> twenty_five;
+		TS_ASSERT_EQUALS(twenty_five.next(), SolutionIterator<5>::FOUND);
+		vector<int> cells;
+		twenty_five.getSolution(cells);
+		GridBacktracker<5> check;
+		TS_ASSERT(check.load(cells));
+		TS_ASSERT_EQUALS(cells.size(), 625);
+		for(int i = 0; i < 625; i++) {
+			TS_ASSERT(cells[i] >= 1 && cells[i] <= 25);
+		}
+	}
+
+	void testUnsolvable() {
+		SolutionIterator<3> solutions;
+		vector<int> conflict(81, -1);
+		conflict[0] = 5;
+		conflict[1] = 5;
+		TS_ASSERT(!solutions.load(conflict));
+		TS_ASSERT(solutions.isFinished());
+		TS_ASSERT_EQUALS(solutions.next(), SolutionIterator<3>::FINISHED);
+		Sudoku sudoku("1.657..9.84..2.1...5.9.4...6.....2.3.82.9.74.4.7.....1...4.2.1...5.8..39.7..598.4");
+		solutions = sudoku.getSolutionIterator();
+		TS_ASSERT_EQUALS(solutions.next(), SolutionIterator<3>::FINISHED);
+		TS_ASSERT_EQUALS(solutions.getSolutions(), 0);
+	}
+
+};
+
+const string SolutionIteratorTest::MULTIPLE =
+	"87.39.........85.9....5.1...2.1..3.44.3...2.56.8..4.9...2.4....7........5...17.4.";
+
+#endif
@@ -0,0 +1,198 @@
+/**
+ * @file SolverServerTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the SolverServer class.
+ */
+
+#ifndef SOLVER_SERVER_TEST_H
+#define SOLVER_SERVER_TEST_H
+
+//Protected includes
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/SolverServer.h"
+
+using namespace std;
+
+class SolverServerTest : public CxxTest::TestSuite {
+
+private:
+
+	static const string PUZZLE;
+	static const string SOLUTION;
+
+	//Reads everything from a descriptor until end of file
+	static string readAll(int input) {
+		string text;
+		char buffer[4096];
+		ssize_t count;
+		while((count = read(input, buffer, sizeof(buffer))) > 0) {
+			text.append(buffer, count);
+		}
+		return text;
+	}
+
+	//Splits responses into a map from ID to the rest of the line
+	static map<string, string> getResponses(const string& text) {
+		map<string, string> responses;
+		istringstream lines(text);
+		string line;
+		while(getline(lines, line)) {
+			size_t split = line.find(' ');
+			responses[line.substr(0, split)] = line.substr(split + 1);
+		}
+		return responses;
+	}
+
+	//Sends requests through a pair of pipes to a server, returning its responses
+	static string serve(SolverServer& server, const string& requests, long& count) {
+		int input[2];
+		int output[2];
+		TS_ASSERT_EQUALS(pipe(input), 0);
+		TS_ASSERT_EQUALS(pipe(output), 0);
+		thread writer([&]() {
+			TS_ASSERT_EQUALS(write(input[1], requests.data(), requests.size()), (ssize_t)requests.size());
+			close(input[1]);
+		});
+		string text;
+		thread reader([&]() {
+			text = readAll(output[0]);
+		});
+		count = server.serve(input[0], output[1]);
+		close(output[1]);
+		writer.join();
+		reader.join();
+		close(input[0]);
+		close(output[0]);
+		return text;
+	}
+
+public:
+
+	void testParseRequest() {
+		string id;
+		const char* puzzle = NULL;
+		size_t length = 0;
+		string line = "  job-7 \t" + PUZZLE + " ";
+		TS_ASSERT(SolverServer::parseRequest(line.data(), line.size(), 3, id, puzzle, length));
+		TS_ASSERT_EQUALS(id, "job-7");
+		TS_ASSERT_EQUALS(string(puzzle, length), PUZZLE);
+		//A bare puzzle is numbered by its position
+		TS_ASSERT(SolverServer::parseRequest(PUZZLE.data(), PUZZLE.size(), 3, id, puzzle, length));
+		TS_ASSERT_EQUALS(id, "3");
+		TS_ASSERT_EQUALS(length, 81);
+		TS_ASSERT(!SolverServer::parseRequest("  ", 2, 4, id, puzzle, length));
+	}
+
+	void testAnswer() {
+		Sudoku sudoku("");
+		string response;
+		SolverServer::answer(sudoku, "a", PUZZLE.data(), PUZZLE.size(), response);
+		TS_ASSERT_EQUALS(response, "a " + SOLUTION + "\n");
+		string conflict = PUZZLE;
+		conflict[1] = conflict[0];
+		SolverServer::answer(sudoku, "b", conflict.data(), conflict.size(), response);
+		TS_ASSERT_EQUALS(response, "b unsolvable\n");
+		SolverServer::answer(sudoku, "c", "123", 3, response);
+		TS_ASSERT_EQUALS(response.compare(0, 8, "c error "), 0);
+		SearchLimits limits;
+		limits.setMaxNodes(10);
+		SolverServer::answer(sudoku, "d", PUZZLE.data(), PUZZLE.size(), response, limits);
+		TS_ASSERT_EQUALS(response, "d exhausted\n");
+	}
+
+	void testServeWithBudget() {
+		Sudoku configuration("");
+		SolverServer server(configuration, 2);
+		server.setMaxNodes(10);
+		string easy = PUZZLE;
+		for(int i = 0; i < 81; i++) {
+			easy[i] = SOLUTION[i];
+		}
+		easy[0] = '.';
+		long count = 0;
+		map<string, string> responses = getResponses(serve(server, "hard " + PUZZLE + "\neasy " + easy + "\n", count));
+		TS_ASSERT_EQUALS(responses["hard"], "exhausted");
+		TS_ASSERT_EQUALS(responses["easy"], SOLUTION);
+	}
+
+	void testServePipelined() {
+		Sudoku configuration("");
+		SolverServer server(configuration, 3);
+		string requests;
+		for(int i = 0; i < 40; i++) {
+			requests += "p" + to_string(i) + " " + PUZZLE + "\r\n";
+		}
+		requests += "# a comment\n\nbad 12345\n" + string(5000, '.') + "\n" + PUZZLE;
+		long count = 0;
+		string text = serve(server, requests, count);
+		TS_ASSERT_EQUALS(count, 43);
+		TS_ASSERT_EQUALS(server.getRequests(), 43);
+		map<string, string> responses = getResponses(text);
+		TS_ASSERT_EQUALS(responses.size(), 43);
+		for(int i = 0; i < 40; i++) {
+			TS_ASSERT_EQUALS(responses["p" + to_string(i)], SOLUTION);
+		}
+		TS_ASSERT_EQUALS(responses["bad"].compare(0, 6, "error "), 0);
+		TS_ASSERT_EQUALS(responses["42"], "error request too long");
+		//The last line has no terminator, and no ID
+		TS_ASSERT_EQUALS(responses["43"], SOLUTION);
+	}
+
+	void testListen() {
+		Sudoku configuration("");
+		SolverServer server(configuration, 2);
+		string path = "solver_server_test.sock";
+		bool listened = false;
+		thread listener([&]() {
+			listened = server.listen(path);
+		});
+		int client = -1;
+		sockaddr_un address;
+		memset(&address, 0, sizeof(address));
+		address.sun_family = AF_UNIX;
+		memcpy(address.sun_path, path.data(), path.size());
+		//Retry until the server is listening
+		for(int attempt = 0; attempt < 500; attempt++) {
+			client = socket(AF_UNIX, SOCK_STREAM, 0);
+			if(connect(client, (sockaddr*)&address, sizeof(address)) == 0) {
+				break;
+			}
+			close(client);
+			client = -1;
+			usleep(2000);
+		}
+		TS_ASSERT(client >= 0);
+		if(client >= 0) {
+			string requests = "x " + PUZZLE + "\ny " + PUZZLE + "\n";
+			TS_ASSERT_EQUALS(write(client, requests.data(), requests.size()), (ssize_t)requests.size());
+			shutdown(client, SHUT_WR);
+			map<string, string> responses = getResponses(readAll(client));
+			TS_ASSERT_EQUALS(responses["x"], SOLUTION);
+			TS_ASSERT_EQUALS(responses["y"], SOLUTION);
+			close(client);
+		}
+		server.stop();
+		listener.join();
+		TS_ASSERT(listened);
+		TS_ASSERT_EQUALS(access(path.c_str(), F_OK), -1);
+	}
+
+};
+
+const string SolverServerTest::PUZZLE =
+	"4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......";
+const string SolverServerTest::SOLUTION =
+	"417369825632158947958724316825437169791586432346912758289643571573291684164875293";
+
+#endif
@@ -209,6 +209,163 @@ public:
 
 	}
 
+	void testSolveWithinLimits() {
+
+		//Takes plain backtracking millions of nodes (and propagation only one)
+		string state = "4.....8.5"
+					   ".3......."
+					   "...7....."
+					   ".2.....6."
+					   "....8.4.."
+					   "....1...."
+					   "...6.3.7."
+					   "5..2....."
+					   "1.4......";
+
+		Sudoku s(state);
+		SearchLimits limits;
+		limits.setMaxNodes(10);
+		TS_ASSERT_EQUALS(s.solve(limits), Sudoku::BUDGET_EXHAUSTED);
+		//The partial counters are kept, and the board is left as it was
+		TS_ASSERT_EQUALS(s.getStats().nodes, 10);
+		TS_ASSERT(s.getCurrentBoard() == s.getStartingBoard());
+
+		Sudoku s2(state, Sudoku::DANCING_LINKS);
+		TS_ASSERT_EQUALS(s2.solve(limits), Sudoku::BUDGET_EXHAUSTED);
+		TS_ASSERT_EQUALS(s2.getStats().nodes, 10);
+
+		//A deadline already passed, or a tripped token, stops the search at a checkpoint
+		SearchLimits late;
+		late.setTimeout(0);
+		TS_ASSERT_EQUALS(s.solve(late), Sudoku::BUDGET_EXHAUSTED);
+		TS_ASSERT(s.getStats().nodes <= SearchLimits::CHECK_INTERVAL);
+		CancellationToken token;
+		token.cancel();
+		SearchLimits cancelled;
+		cancelled.setCancellation(&token);
+		TS_ASSERT_EQUALS(s.solve(cancelled), Sudoku::BUDGET_EXHAUSTED);
+
+		//The parallel search shares the budget between its workers
+		Sudoku s3(state);
+		s3.setThreads(2);
+		TS_ASSERT_EQUALS(s3.solve(limits), Sudoku::BUDGET_EXHAUSTED);
+
+		//Exhausted searches are not cached
+		SolutionCache cache(10);
+		s.setCache(&cache);
+		TS_ASSERT_EQUALS(s.solve(limits), Sudoku::BUDGET_EXHAUSTED);
+		TS_ASSERT_EQUALS(cache.size(), 0);
+
+		//With enough budget, the search finishes as usual
+		s.setPropagation(true);
+		s3.setPropagation(true);
+		limits.setMaxNodes(1000);
+		TS_ASSERT_EQUALS(s.solve(limits), Sudoku::SOLVED);
+		TS_ASSERT(s.isComplete());
+		TS_ASSERT_EQUALS(cache.size(), 1);
+		TS_ASSERT_EQUALS(s3.solve(limits), Sudoku::SOLVED);
+
+		state = "1.657..9."
+				"84..2.1.."
+				".5.9.4..."
+				"6.....2.3"
+				".82.9.74."
+				"4.7.....1"
+				"...4.2.1."
+				"..5.8..39"
+				".7..598.4";
+
+		Sudoku s4(state);
+		TS_ASSERT_EQUALS(s4.solve(limits), Sudoku::UNSOLVABLE);
+
+	}
+
+	void testCountSolutions() {
+
+		string state = "87.39...."
+					   ".....85.9"
+					   "....5.1.."
+					   ".2.1..3.4"
+					   "4.3...2.5"
+					   "6.8..4.9."
+					   "..2.4...."
+					   "7........"
+					   "5...17.4.";
+
+		Sudoku s(state);
+		TS_ASSERT_EQUALS(s.countSolutions(), 24);
+		TS_ASSERT_EQUALS(s.countSolutions(5), 5);
+		TS_ASSERT(!s.hasUniqueSolution());
+		//Counting leaves the current board untouched
+		TS_ASSERT(s.getCurrentBoard() == s.getStartingBoard());
+
+		Sudoku s2(state, Sudoku::DANCING_LINKS);
+		TS_ASSERT_EQUALS(s2.countSolutions(), 24);
+
+		state = "1.657..9."
+				"84..2.1.."
+				".5.9.4..."
+				"6.....2.3"
+				".82.9.74."
+				"4.7.....1"
+				"...4.2.1."
+				"..5.8..39"
+				".7..598.4";
+
+		Sudoku s3(state);
+		TS_ASSERT_EQUALS(s3.countSolutions(), 0);
+		TS_ASSERT(!s3.hasUniqueSolution());
+
+		state = ".23456789"
+				"4.6789123"
+				"78.123456"
+				"234.67891"
+				"5678.1234"
+				"89123.567"
+				"345678.12"
+				"6789123.5"
+				"91234567.";
+
+		Sudoku s4(state);
+		TS_ASSERT(s4.hasUniqueSolution());
+
+	}
+
+	void testForEachSolution() {
+
+		//Collects the first digit of each solution, and stops after 'stop_after' of them
+		class FirstDigits : public SolutionCallback {
+		public:
+			vector<int> digits;
+			int stop_after;
+			bool onSolution(const int* board) {
+				this->digits.push_back(board[2]);
+				return (int)this->digits.size() < this->stop_after;
+			}
+		};
+
+		string state = "87.39...."
+					   ".....85.9"
+					   "....5.1.."
+					   ".2.1..3.4"
+					   "4.3...2.5"
+					   "6.8..4.9."
+					   "..2.4...."
+					   "7........"
+					   "5...17.4.";
+
+		Sudoku s(state);
+		FirstDigits all;
+		all.stop_after = 100;
+		TS_ASSERT_EQUALS(s.forEachSolution(all), 24);
+		TS_ASSERT_EQUALS(all.digits.size(), 24);
+
+		FirstDigits some;
+		some.stop_after = 3;
+		TS_ASSERT_EQUALS(s.forEachSolution(some), 3);
+
+	}
+
 };
 
-#endif
\ No newline at end of file
+#endif
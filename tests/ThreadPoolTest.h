@@ -0,0 +1,65 @@
+/**
+ * @file ThreadPoolTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the ThreadPool class.
+ */
+
+#ifndef THREAD_POOL_TEST_H
+#define THREAD_POOL_TEST_H
+
+//Protected includes
+#include <vector>
+#include <atomic>
+#include <cxxtest/TestSuite.h>
+
+//Header include
+#include "../lib/ThreadPool.h"
+
+using namespace std;
+
+class ThreadPoolTest : public CxxTest::TestSuite {
+
+public:
+
+	void testRunsEveryTask() {
+		ThreadPool pool(4);
+		TS_ASSERT_EQUALS(pool.size(), 4);
+		atomic<int> sum(0);
+		for(int i = 1; i <= 1000; i++) {
+			pool.submit([i, &sum](int worker) {
+				sum += i;
+			});
+		}
+		pool.wait();
+		TS_ASSERT_EQUALS(sum.load(), 500500);
+		TS_ASSERT_EQUALS(ThreadPool::getCurrentWorker(), -1);
+	}
+
+	void testTasksCanSubmitTasks() {
+		ThreadPool pool(3);
+		atomic<int> leaves(0);
+		//Each task splits in two until depth 10, giving 1024 leaves
+		function<void (int, int)> split = [&](int depth, int worker) {
+			TS_ASSERT_EQUALS(ThreadPool::getCurrentWorker(), worker);
+			if(depth == 10) {
+				leaves++;
+				return;
+			}
+			for(int k = 0; k < 2; k++) {
+				pool.submit([depth, &split](int w) {
+					split(depth + 1, w);
+				});
+			}
+		};
+		pool.submit([&split](int w) {
+			split(0, w);
+		});
+		pool.wait();
+		TS_ASSERT_EQUALS(leaves.load(), 1024);
+	}
+
+};
+
+#endif
@@ -0,0 +1,166 @@
+/**
+ * @file TriageTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the Triage class, and for the triage stage run by the Sudoku
+ * class before every search.
+ */
+
+#ifndef TRIAGE_TEST_H
+#define TRIAGE_TEST_H
+
+//Protected includes
+#include <string>
+#include <cxxtest/TestSuite.h>
+
+//Header includes
+#include "../lib/Triage.h"
+#include "../lib/Sudoku.h"
+#include "../lib/BoardKernels.h"
+
+using namespace std;
+
+class TriageTest : public CxxTest::TestSuite {
+
+private:
+
+	static const string PUZZLE;
+	//Has no solution: no cell of the eighth row can take a 4
+	static const string UNSOLVABLE;
+
+	//Checks a puzzle's text and board, returning the description of the result
+	static string triage(const string& text, Triage& result) {
+		Board board;
+		result.check(text.data(), text.size(), board);
+		string description;
+		result.describe(description);
+		return description;
+	}
+
+public:
+
+	void testMalformedText() {
+		Triage result;
+		TS_ASSERT_EQUALS(triage(PUZZLE.substr(0, 80), result), "expected 81 cells, found 80");
+		TS_ASSERT_EQUALS(result.getReason(), Triage::BAD_LENGTH);
+		TS_ASSERT_EQUALS(result.getLength(), 80);
+		TS_ASSERT(result.isRejected());
+		string garbage = PUZZLE;
+		garbage[4] = 'x';
+		TS_ASSERT_EQUALS(triage(garbage, result), "invalid character 'x' at position 5");
+		TS_ASSERT_EQUALS(result.getReason(), Triage::BAD_CHARACTER);
+		TS_ASSERT_EQUALS(result.getIndex(), 4);
+		TS_ASSERT_EQUALS(result.getCharacter(), 'x');
+		//Both blank forms are accepted
+		string zeros = PUZZLE;
+		zeros[1] = '0';
+		TS_ASSERT(result.checkText(zeros.data(), zeros.size()));
+		TS_ASSERT(!result.isRejected());
+	}
+
+	void testConflictingGivens() {
+		Triage result;
+		string conflict = PUZZLE;
+		conflict[4] = '4';
+		TS_ASSERT_EQUALS(triage(conflict, result), "cells r1c1 and r1c5 both hold 4 in row 1");
+		TS_ASSERT_EQUALS(result.getReason(), Triage::CONFLICT);
+		TS_ASSERT_EQUALS(result.getIndex(), 0);
+		TS_ASSERT_EQUALS(result.getOtherIndex(), 4);
+		TS_ASSERT_EQUALS(result.getUnit(), 0);
+		TS_ASSERT_EQUALS(result.getDigit(), 4);
+		//A board built from elsewhere can hold an invalid cell
+		Board board;
+		board.set(10, Board::INVALID);
+		TS_ASSERT(!result.checkBoard(board));
+		TS_ASSERT_EQUALS(result.getReason(), Triage::BAD_CHARACTER);
+		TS_ASSERT_EQUALS(result.getIndex(), 10);
+	}
+
+	void testDeadCellsAndDigits() {
+		Triage result;
+		//The first cell's row leaves it only a 9, which its column already holds
+		string dead_cell(81, '.');
+		dead_cell.replace(0, 9, ".12345678");
+		dead_cell[27] = '9';
+		TS_ASSERT_EQUALS(triage(dead_cell, result), "no digit can go in cell r1c1");
+		TS_ASSERT_EQUALS(result.getReason(), Triage::DEAD_CELL);
+		TS_ASSERT_EQUALS(result.getIndex(), 0);
+		//Both of the first row's empty cells can take a 2, but neither can take a 1
+		string dead_digit(81, '.');
+		dead_digit.replace(0, 9, "..3456789");
+		dead_digit[27] = '1';
+		dead_digit[64] = '1';
+		TS_ASSERT_EQUALS(triage(dead_digit, result), "1 can go nowhere in row 1");
+		TS_ASSERT_EQUALS(result.getReason(), Triage::DEAD_DIGIT);
+		TS_ASSERT_EQUALS(result.getUnit(), 0);
+		TS_ASSERT_EQUALS(result.getDigit(), 1);
+		TS_ASSERT_EQUALS(triage(UNSOLVABLE, result), "4 can go nowhere in row 8");
+	}
+
+	void testPropagationContradiction() {
+		Triage result;
+		//A wrong digit that conflicts with no given, found out by filling singles
+		string wrong = PUZZLE;
+		wrong[1] = '6';
+		TS_ASSERT_EQUALS(triage(wrong, result), "after filling 4 singles, 6 can go nowhere in square 7");
+		TS_ASSERT_EQUALS(result.getReason(), Triage::CONTRADICTION);
+		TS_ASSERT_EQUALS(result.getPropagated(), 4);
+		TS_ASSERT_EQUALS(result.getUnit(), 24);
+		TS_ASSERT_EQUALS(string(Triage::getReasonName(result.getReason())), "contradiction");
+	}
+
+	void testSolvablePuzzlesPass() {
+		Triage result;
+		TS_ASSERT_EQUALS(triage(PUZZLE, result), "passed");
+		TS_ASSERT_EQUALS(result.getReason(), Triage::PASSED);
+		TS_ASSERT_EQUALS(result.getIndex(), -1);
+		//An easy puzzle is filled in completely by singles
+		string easy = "..3.2.6..9..3.5..1..18.64....81.29..7.......8..67.82....26.95..8..2.3..9..5.1.3..";
+		TS_ASSERT_EQUALS(triage(easy, result), "passed");
+		TS_ASSERT_EQUALS(result.getPropagated(), 49);
+		const Board& filled = result.getFilledBoard();
+		for(int i = 0; i < 81; i++) {
+			TS_ASSERT(!filled.isEmpty(i));
+		}
+		TS_ASSERT(BoardKernels::isValid(filled.data()));
+		TS_ASSERT(result.checkBoard(Board()));
+	}
+
+	void testSudokuTriage() {
+		Sudoku s(UNSOLVABLE);
+		TS_ASSERT(s.getTriage());
+		TS_ASSERT_EQUALS(s.solve(SearchLimits()), Sudoku::UNSOLVABLE);
+		TS_ASSERT_EQUALS(s.getTriageResult().getReason(), Triage::DEAD_DIGIT);
+		TS_ASSERT_EQUALS(s.getStats().nodes, 0);
+		TS_ASSERT_EQUALS(s.countSolutions(), 0);
+		//Without triage, the search has to find out for itself
+		s.setTriage(false);
+		TS_ASSERT(!s.solve());
+		TS_ASSERT(!s.getTriageResult().isRejected());
+		TS_ASSERT(s.getStats().nodes > 0);
+		//The search starts from the singles triage filled in, and finds the same solution
+		Sudoku triaged(PUZZLE, Sudoku::BACKTRACKING);
+		Sudoku untriaged(PUZZLE, Sudoku::BACKTRACKING);
+		untriaged.setTriage(false);
+		TS_ASSERT(triaged.solve());
+		TS_ASSERT(untriaged.solve());
+		TS_ASSERT(triaged.getCurrentBoard() == untriaged.getCurrentBoard());
+		TS_ASSERT_EQUALS(triaged.countSolutions(), 1);
+		//Every engine answers alike
+		Sudoku dlx(UNSOLVABLE, Sudoku::DANCING_LINKS);
+		TS_ASSERT(!dlx.solve());
+		TS_ASSERT(dlx.getTriageResult().isRejected());
+		Sudoku solvable(PUZZLE, Sudoku::TEMPLATES);
+		TS_ASSERT(solvable.solve());
+		TS_ASSERT(!solvable.getTriageResult().isRejected());
+	}
+
+};
+
+const string TriageTest::PUZZLE =
+	"4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......";
+const string TriageTest::UNSOLVABLE =
+	"1.657..9.84..2.1...5.9.4...6.....2.3.82.9.74.4.7.....1...4.2.1...5.8..39.7..598.4";
+
+#endif
@@ -15,6 +15,9 @@
 #include <cstdlib>
 #include <string>
 #include <sstream>
+#include <cstring>
+#include <algorithm>
+#include <functional>
 
 //Header include
 #include "utils.h"
@@ -98,6 +101,11 @@ string Utilities::stripCharacters(const string &s, vector<char> &rm) {
 	return ret;
 }
 
+//Returns whether a character is one of the whitespace characters removed below
+static bool isWhitespace(char c) {
+	return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
 /**
  * Similar to Utilities::stripCharacters. Returns a new string in which all whitespace
  * characters have been sequentially removed. Includes single spaces, tabs, newlines,
@@ -108,20 +116,10 @@ string Utilities::stripCharacters(const string &s, vector<char> &rm) {
 string Utilities::stripWhitespaces(const string &s) {
 	//Get the value of the original referenced string
 	string ret = s;
-	//Define a list of all whitespace character values
-	//const char ws_chars[] = {' ', '\t', '\n', '\v', '\f', '\r'};
-	char ws_chars[] = " \t\n\v\f\r";
-	//Iterate over the list, remove any instances of the current char from the string
-	for(int i = 0; i < strlen(ws_chars); i++) {
-		char c = ws_chars[i];
-		ret.erase(
-			//Transforms the range [first,last) into a range with all the elements
-			//that compare equal to 'c' removed, and returns an iterator to the new
-			//end of that range.
-			remove(ret.begin(), ret.end(), c),
-			ret.end()
-		);
-	}
+	//Remove every whitespace character (' ', '\t', '\n', '\v', '\f', '\r') in a single
+	//pass; remove_if transforms the range [first,last) into a range with all the
+	//matching elements removed, and returns an iterator to the new end of that range.
+	ret.erase(remove_if(ret.begin(), ret.end(), isWhitespace), ret.end());
 	return ret;
 }
 